@@ -0,0 +1,243 @@
+//
+//  AtomicStaticBitVector.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef AtomicStaticBitVector_hpp
+#define AtomicStaticBitVector_hpp
+
+#include <atomic>
+#include "BitOptions.hpp"
+#include "BitMasks.hpp"
+
+///
+/// A static bit vector that can be modified by multiple threads concurrently without a lock
+///
+/// Each operation updates a single block with an atomic read-modify-write instruction or a compare-and-swap loop,
+/// so threads that work on different blocks never contend with each other.
+/// `claimFirstZero()` accepts a hint that specifies where the search starts,
+/// so that threads can start in different blocks (e.g. one region per processor) to spread contention.
+///
+/// @tparam NumBits Specify the total number of bits
+/// @tparam StorageUnit Specify the underlying integer type to store bits
+/// @note All operations use acquire-release ordering, so a thread that claims a bit observes
+///       the writes made by the thread that released the bit before the bit was cleared.
+///
+template <size_t NumBits, typename StorageUnit = size_t>
+requires std::unsigned_integral<StorageUnit>
+class AtomicStaticBitVector
+{
+private:
+    /// Compile time constant that stores the number of bits stored in each block
+    static constexpr size_t NumBitsPerOptionsBlock = sizeof(StorageUnit) * 8;
+
+    /// Compile time constant that stores the number of used bits in the last block
+    static constexpr size_t NumUsedBits = NumBits % NumBitsPerOptionsBlock;
+
+    /// Compile time constant that stores the actual number of blocks
+    static constexpr size_t NumOptionsBlocks = (NumBits / NumBitsPerOptionsBlock) + (NumUsedBits ? 1 : 0);
+
+    static_assert(NumBits > 0, "An atomic bit vector must have at least one bit.");
+
+    /// The type of the atomic reference to a block
+    using AtomicBlock = std::atomic_ref<StorageUnit>;
+
+    /// The internal storage
+    /// Blocks are plain integers that are only accessed through atomic references
+    alignas(AtomicBlock::required_alignment) StorageUnit blocks[NumOptionsBlocks];
+
+    ///
+    /// Get the atomic reference to the block at the given index
+    ///
+    /// @param index Index of the block
+    /// @return The atomic reference to the block.
+    ///
+    inline AtomicBlock getBlock(size_t index)
+    {
+        return AtomicBlock(this->blocks[index]);
+    }
+
+    ///
+    /// Get the atomic reference to the block at the given index
+    ///
+    /// @param index Index of the block
+    /// @return The atomic reference to the block.
+    /// @note Loading from an atomic reference does not modify the block.
+    ///
+    inline AtomicBlock getBlock(size_t index) const
+    {
+        return AtomicBlock(const_cast<StorageUnit&>(this->blocks[index]));
+    }
+
+    ///
+    /// Get the bit mask of existing bits in the block at the given index
+    ///
+    /// @param index Index of the block
+    /// @return A bit mask that has all existing bits in the block set.
+    ///
+    static inline StorageUnit getBlockMask(size_t index)
+    {
+        if (NumUsedBits != 0 && index == NumOptionsBlocks - 1)
+        {
+            return BitMask<StorageUnit>::createWithLowBitsSet(NumUsedBits);
+        }
+
+        return ~static_cast<StorageUnit>(0);
+    }
+
+#ifdef DEBUG
+    friend class AtomicStaticBitVectorTest;
+#endif
+
+public:
+    // MARK: Initialize a Bit Vector
+    // Initializers are not atomic, so they must be called before the vector is shared with other threads.
+
+    /// Initialize the bit vector with all zeros
+    void initWithZeros()
+    {
+        for (auto& block : this->blocks)
+        {
+            block = 0;
+        }
+    }
+
+    /// Initialize the bit vector with all ones
+    void initWithOnes()
+    {
+        for (size_t index = 0; index < NumOptionsBlocks; index += 1)
+        {
+            this->blocks[index] = getBlockMask(index);
+        }
+    }
+
+    // MARK: Examine and modify a bit atomically
+
+    ///
+    /// Check whether the given bit is set in the vector
+    ///
+    /// @param index Index of the bit
+    /// @return `true` if the bit at the given index is set, `false` otherwise or if the given index is invalid.
+    ///
+    [[nodiscard]]
+    inline bool containsBit(size_t index) const
+    {
+        // Guard: Ensure that the index is not out-of-bound
+        if (index >= NumBits)
+        {
+            return false;
+        }
+
+        StorageUnit value = this->getBlock(index / NumBitsPerOptionsBlock).load(std::memory_order_acquire);
+
+        return BitOptions<StorageUnit>(value).containsBit(index % NumBitsPerOptionsBlock);
+    }
+
+    ///
+    /// Set the bit at the given index and report its previous value atomically
+    ///
+    /// @param index Index of the bit
+    /// @return `true` if the bit was already set, `false` if this call has set the bit or if the given index is invalid.
+    ///
+    inline bool testAndSet(size_t index)
+    {
+        // Guard: Ensure that the index is not out-of-bound
+        if (index >= NumBits)
+        {
+            return false;
+        }
+
+        StorageUnit mask = static_cast<StorageUnit>(1) << (index % NumBitsPerOptionsBlock);
+
+        return (this->getBlock(index / NumBitsPerOptionsBlock).fetch_or(mask, std::memory_order_acq_rel) & mask) != 0;
+    }
+
+    ///
+    /// Clear the bit at the given index and report its previous value atomically
+    ///
+    /// @param index Index of the bit
+    /// @return `true` if this call has cleared the bit, `false` if the bit was already clear or if the given index is invalid.
+    ///
+    inline bool testAndClear(size_t index)
+    {
+        // Guard: Ensure that the index is not out-of-bound
+        if (index >= NumBits)
+        {
+            return false;
+        }
+
+        StorageUnit mask = static_cast<StorageUnit>(1) << (index % NumBitsPerOptionsBlock);
+
+        return (this->getBlock(index / NumBitsPerOptionsBlock).fetch_and(static_cast<StorageUnit>(~mask), std::memory_order_acq_rel) & mask) != 0;
+    }
+
+    ///
+    /// Find a zero bit and set it atomically
+    ///
+    /// @param hint Index of the bit where the search starts, e.g. a different region for each processor
+    /// @return The index of the bit claimed by this call on success, `-1` if all bits are set.
+    /// @note The search starts at the block that contains the hinted bit and wraps around at the end of the vector.
+    ///       A block is visited at most once, and the compare-and-swap is only retried while the block still has a zero bit.
+    ///
+    [[nodiscard]]
+    ssize_t claimFirstZero(size_t hint = 0)
+    {
+        size_t start = (hint % NumBits) / NumBitsPerOptionsBlock;
+
+        for (size_t count = 0; count < NumOptionsBlocks; count += 1)
+        {
+            size_t index = start + count < NumOptionsBlocks ? start + count : start + count - NumOptionsBlocks;
+
+            AtomicBlock block = this->getBlock(index);
+
+            StorageUnit value = block.load(std::memory_order_relaxed);
+
+            StorageUnit zeros = static_cast<StorageUnit>(~value) & getBlockMask(index);
+
+            while (zeros != 0)
+            {
+                // Claim the lowest zero bit
+                uint32_t offset = BitOptions<StorageUnit>(zeros).findLeastSignificantBitIndex();
+
+                StorageUnit mask = static_cast<StorageUnit>(1) << offset;
+
+                // On failure, `value` is reloaded, so the next attempt picks a bit that is still clear
+                if (block.compare_exchange_weak(value, value | mask, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    return static_cast<ssize_t>(index * NumBitsPerOptionsBlock + offset);
+                }
+
+                zeros = static_cast<StorageUnit>(~value) & getBlockMask(index);
+            }
+        }
+
+        // All bits are set
+        return -1;
+    }
+
+    // MARK: Count bits in the vector
+
+    ///
+    /// Count the number of set bits in the vector
+    ///
+    /// @return The number of set bits.
+    /// @note The result is not a consistent snapshot if other threads modify the vector concurrently.
+    ///
+    [[nodiscard]]
+    size_t count() const
+    {
+        size_t count = 0;
+
+        for (size_t index = 0; index < NumOptionsBlocks; index += 1)
+        {
+            count += BitOptions<StorageUnit>(this->getBlock(index).load(std::memory_order_relaxed)).count();
+        }
+
+        return count;
+    }
+};
+
+#endif /* AtomicStaticBitVector_hpp */
@@ -0,0 +1,336 @@
+//
+//  BitFlags.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitFlags_hpp
+#define BitFlags_hpp
+
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+#include "BitOptions.hpp"
+
+///
+/// Specify an enumeration whose enumerators are bit indices, and whose largest index is named `MaxValue`
+///
+/// Example:
+///
+/// ```
+/// enum class SyscallFlag
+/// {
+///     Traced,
+///     Restartable,
+///     Privileged,
+///     MaxValue = Privileged
+/// };
+/// ```
+///
+template <typename Enum>
+concept BitFlagsEnum = std::is_enum_v<Enum> && requires { Enum::MaxValue; };
+
+///
+/// Get the smallest unsigned integer type that has at least the given number of bits
+///
+/// @tparam NumBits Specify the number of bits
+///
+template <size_t NumBits>
+requires (NumBits <= 64)
+using SmallestUnsignedIntegral = std::conditional_t<NumBits <= 8, uint8_t,
+                                 std::conditional_t<NumBits <= 16, uint16_t,
+                                 std::conditional_t<NumBits <= 32, uint32_t, uint64_t>>>;
+
+///
+/// Represents a collection of flags keyed by an enumeration
+///
+/// `BitFlags` is a type-safe wrapper of `BitOptions` that accepts enumerators rather than raw bit masks,
+/// so that flags of different enumerations cannot be mixed up.
+/// The storage is the smallest unsigned integer that can hold the largest index, e.g. `uint8_t` for up to 8 flags.
+/// All operations are `constexpr`, so a collection of flags known at compile time is a constant,
+/// and checking it against a collection known at runtime compiles down to a single `test` instruction.
+///
+/// Example:
+///
+/// ```
+/// static constexpr BitFlags kRestartableSyscall(SyscallFlag::Restartable, SyscallFlag::Traced);
+///
+/// if (flags.containsAll(SyscallFlag::Restartable, SyscallFlag::Traced)) { ... }
+/// ```
+///
+/// @tparam Enum Specify the enumeration whose enumerators are bit indices
+///
+template <typename Enum>
+requires BitFlagsEnum<Enum>
+struct BitFlags
+{
+public:
+    /// The underlying integer type to store flags
+    using StorageUnit = SmallestUnsignedIntegral<static_cast<size_t>(Enum::MaxValue) + 1>;
+
+private:
+    /// The internal storage
+    BitOptions<StorageUnit> options;
+
+    /// Create a collection of flags from the given raw value
+    constexpr explicit BitFlags(BitOptions<StorageUnit> options) : options(options) {}
+
+    ///
+    /// Get the bit option of the given flag
+    ///
+    /// @param flag A flag
+    /// @return The bit option that has the bit of the given flag set.
+    ///
+    static constexpr StorageUnit createOption(Enum flag)
+    {
+        return BitOptions<StorageUnit>::createOptionWithIndex(static_cast<size_t>(flag));
+    }
+
+    ///
+    /// Get the bit options of the given flags
+    ///
+    /// @param flags Zero or more flags
+    /// @return The bit options that have the bits of all given flags set.
+    ///
+    template <typename... Flags>
+    static constexpr StorageUnit createMask(Flags... flags)
+    {
+        return (static_cast<StorageUnit>(0) | ... | createOption(flags));
+    }
+
+public:
+    /// Compile time constant that stores the number of valid flags
+    static constexpr size_t NumFlags = static_cast<size_t>(Enum::MaxValue) + 1;
+
+    /// Create an empty collection of flags
+    constexpr BitFlags() : options(0) {}
+
+    ///
+    /// Create a collection of the given flags
+    ///
+    /// @param flags One or more flags
+    ///
+    template <typename... Flags>
+    requires (sizeof...(Flags) > 0) && (std::same_as<Flags, Enum> && ...)
+    constexpr explicit(sizeof...(Flags) > 1) BitFlags(Flags... flags) : options(createMask(flags...)) {}
+
+    ///
+    /// Create a collection of flags from the given raw value
+    ///
+    /// @param value The raw value, e.g. loaded from a register
+    /// @return The collection of flags that has bits beyond the largest index cleared.
+    ///
+    static constexpr BitFlags createWithRawValue(StorageUnit value)
+    {
+        return BitFlags(BitOptions<StorageUnit>(value & BitFlags::all().getRawValue()));
+    }
+
+    ///
+    /// Create a collection of all valid flags
+    ///
+    /// @return The collection that has all flags from index 0 to `Enum::MaxValue` set.
+    ///
+    static constexpr BitFlags all()
+    {
+        // Cast the complement back before shifting, because small integers are promoted to `int`
+        StorageUnit ones = static_cast<StorageUnit>(~static_cast<StorageUnit>(0));
+
+        return BitFlags(BitOptions<StorageUnit>(static_cast<StorageUnit>(ones >> (sizeof(StorageUnit) * 8 - NumFlags))));
+    }
+
+    // MARK: Examine flags
+
+    ///
+    /// Check whether the given flag is in this collection
+    ///
+    /// @param flag A flag
+    /// @return `true` if the flag is set, `false` otherwise.
+    ///
+    [[nodiscard]]
+    constexpr bool contains(Enum flag) const
+    {
+        return this->options.contains(createOption(flag));
+    }
+
+    ///
+    /// Check whether at least one of the given flags is in this collection
+    ///
+    /// @param flags One or more flags
+    /// @return `true` if at least one of the given flags is set, `false` otherwise.
+    /// @note The flags are combined into a single mask, so the check is a single `test` instruction.
+    ///
+    template <typename... Flags>
+    requires (std::same_as<Flags, Enum> && ...)
+    [[nodiscard]]
+    constexpr bool containsOneOf(Flags... flags) const
+    {
+        return !this->options.bitwiseAnd(createMask(flags...)).isEmpty();
+    }
+
+    ///
+    /// Check whether all of the given flags are in this collection
+    ///
+    /// @param flags One or more flags
+    /// @return `true` if all given flags are set, `false` otherwise.
+    /// @note The flags are combined into a single mask, so the check is a single `and` and `cmp` at most.
+    ///
+    template <typename... Flags>
+    requires (std::same_as<Flags, Enum> && ...)
+    [[nodiscard]]
+    constexpr bool containsAll(Flags... flags) const
+    {
+        return this->options.contains(createMask(flags...));
+    }
+
+    ///
+    /// Check whether this collection has no flags set
+    ///
+    /// @return `true` if it is empty, `false` otherwise.
+    ///
+    [[nodiscard]]
+    constexpr bool isEmpty() const
+    {
+        return this->options.isEmpty();
+    }
+
+    ///
+    /// Count the number of flags set in this collection
+    ///
+    /// @return The number of flags.
+    ///
+    [[nodiscard]]
+    constexpr uint32_t count() const
+    {
+        return this->options.count();
+    }
+
+    ///
+    /// Get the raw value of this collection
+    ///
+    /// @return The raw value, e.g. to be stored in a register.
+    ///
+    [[nodiscard]]
+    constexpr StorageUnit getRawValue() const
+    {
+        return this->options.flatten();
+    }
+
+    ///
+    /// Call the given action on each flag set in this collection in ascending order
+    ///
+    /// @param action A functor that takes each flag
+    ///
+    template <typename Action>
+    requires std::invocable<Action, Enum>
+    constexpr void forEachFlag(Action action) const
+    {
+        this->options.forEachSetBit([&](uint32_t index) -> void { action(static_cast<Enum>(index)); });
+    }
+
+    // MARK: Modify flags
+
+    ///
+    /// Insert the given flags
+    ///
+    /// @param flags One or more flags
+    ///
+    template <typename... Flags>
+    requires (std::same_as<Flags, Enum> && ...)
+    constexpr void mutativeInsert(Flags... flags)
+    {
+        this->options.mutativeInsert(createMask(flags...));
+    }
+
+    ///
+    /// Remove the given flags
+    ///
+    /// @param flags One or more flags
+    ///
+    template <typename... Flags>
+    requires (std::same_as<Flags, Enum> && ...)
+    constexpr void mutativeRemove(Flags... flags)
+    {
+        this->options.mutativeRemove(createMask(flags...));
+    }
+
+    ///
+    /// Insert the given flags and return the new collection
+    ///
+    /// @param flags One or more flags
+    /// @return The new collection after the insertion.
+    ///
+    template <typename... Flags>
+    requires (std::same_as<Flags, Enum> && ...)
+    [[nodiscard]]
+    constexpr BitFlags insert(Flags... flags) const
+    {
+        return BitFlags(this->options.insert(createMask(flags...)));
+    }
+
+    ///
+    /// Remove the given flags and return the new collection
+    ///
+    /// @param flags One or more flags
+    /// @return The new collection after the removal.
+    ///
+    template <typename... Flags>
+    requires (std::same_as<Flags, Enum> && ...)
+    [[nodiscard]]
+    constexpr BitFlags remove(Flags... flags) const
+    {
+        return BitFlags(this->options.remove(createMask(flags...)));
+    }
+
+    // MARK: Operators
+
+    /// Get the union of two collections
+    constexpr BitFlags operator|(const BitFlags& rhs) const
+    {
+        return BitFlags(this->options | rhs.options);
+    }
+
+    /// Get the intersection of two collections
+    constexpr BitFlags operator&(const BitFlags& rhs) const
+    {
+        return BitFlags(this->options & rhs.options);
+    }
+
+    /// Get the flags that are in exactly one of two collections
+    constexpr BitFlags operator^(const BitFlags& rhs) const
+    {
+        return BitFlags(BitOptions<StorageUnit>(this->getRawValue() ^ rhs.getRawValue()));
+    }
+
+    /// Get the complement of this collection, which only contains valid flags
+    constexpr BitFlags operator~() const
+    {
+        return BitFlags::all() ^ *this;
+    }
+
+    /// Insert the flags in the given collection
+    constexpr BitFlags& operator|=(const BitFlags& rhs)
+    {
+        this->options |= rhs.options;
+
+        return *this;
+    }
+
+    /// Keep the flags that are also in the given collection
+    constexpr BitFlags& operator&=(const BitFlags& rhs)
+    {
+        this->options &= rhs.options;
+
+        return *this;
+    }
+
+    /// Check whether two collections have the same flags
+    constexpr bool operator==(const BitFlags& rhs) const = default;
+};
+
+/// Deduce the enumeration from the flags passed to the constructor
+template <typename Enum, typename... Flags>
+BitFlags(Enum, Flags...) -> BitFlags<Enum>;
+
+#endif /* BitFlags_hpp */
@@ -12,9 +12,10 @@
 #include <concepts>
 #include <cstddef>
 #include "ClosedRange.hpp"
+#include "WideUnsignedInteger.hpp"
 
 template <typename T>
-requires std::unsigned_integral<T>
+requires ExtendedUnsignedIntegral<T>
 struct BitMask
 {
     ///
@@ -24,9 +25,14 @@ struct BitMask
     /// @return A bit mask with low `n` bits set.
     /// @note For example, if n is 2 then this function returns 0b00000011 for UInt8 type.
     ///
-    static inline T createWithLowBitsSet(size_t n)
+    static constexpr T createWithLowBitsSet(size_t n)
     {
-        if (n >= sizeof(T) * 8)
+        // Wide integers build each word directly rather than shifting and subtracting across words
+        if constexpr (IsWideUnsignedInteger<T>::value)
+        {
+            return T::createWithLowBitsSet(n);
+        }
+        else if (n >= sizeof(T) * 8)
         {
             return ~static_cast<T>(0);
         }
@@ -43,7 +49,7 @@ struct BitMask
     /// @return A bit mask with high `n` bits set.
     /// @note For example, if n is 2 then this function returns 0b11000000 for UInt8 type.
     ///
-    static inline T createWithHighBitsSet(size_t n)
+    static constexpr T createWithHighBitsSet(size_t n)
     {
         return ~BitMask::createWithLowBitsSet(sizeof(T) * 8 - n);
     }
@@ -55,7 +61,7 @@ struct BitMask
     /// @return A bit mask with specified bits set.
     ///
     template <typename Bound = size_t>
-    static inline T createWithRangeOfBitsSet(ClosedRange<Bound> range)
+    static constexpr T createWithRangeOfBitsSet(ClosedRange<Bound> range)
     {
         passert(range.isValid(), "The given range must be valid.");
 
@@ -75,7 +81,7 @@ struct BitMask
     /// @return A bit mask with low `n` bits clear.
     /// @note For example, if n is 2 then this function returns 0b11111100 for UInt8 type.
     ///
-    static inline T createWithLowBitsClear(size_t n)
+    static constexpr T createWithLowBitsClear(size_t n)
     {
         return ~BitMask::createWithLowBitsSet(n);
     }
@@ -87,7 +93,7 @@ struct BitMask
     /// @return A bit mask with high `n` bits clear.
     /// @note For example, if n is 2 then this function returns 0b00111111 for UInt8 type.
     ///
-    static inline T createWithHighBitsClear(size_t n)
+    static constexpr T createWithHighBitsClear(size_t n)
     {
         return ~BitMask::createWithHighBitsSet(n);
     }
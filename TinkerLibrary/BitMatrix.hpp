@@ -0,0 +1,409 @@
+//
+//  BitMatrix.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitMatrix_hpp
+#define BitMatrix_hpp
+
+#include <algorithm>
+#include <type_traits>
+#include "StaticBitVector.hpp"
+
+//
+// MARK: - Expressions
+//
+// An expression describes a boolean filter on the rows of a bit matrix, e.g. `(A & B) | ~C`.
+// The operators below build the expression as a tree of types rather than computing anything,
+// so that the matrix evaluates the whole tree on each block in a single pass over the rows,
+// without materializing a bit vector for each intermediate result.
+// Each expression provides the following members:
+//
+// - `evaluate(fetch)`: Evaluate the expression on a block, where `fetch(row)` returns the block of the given row.
+// - `getMaxRowIndex()`: The largest index of the rows that the expression refers to.
+//
+
+/// An expression that refers to a row of a bit matrix
+struct BitMatrixRow
+{
+    /// Index of the row
+    size_t index;
+
+    /// Create an expression that refers to the row at the given index
+    constexpr explicit BitMatrixRow(size_t index) : index(index) {}
+
+    template <typename Fetch>
+    constexpr auto evaluate(const Fetch& fetch) const
+    {
+        return fetch(this->index);
+    }
+
+    [[nodiscard]]
+    constexpr size_t getMaxRowIndex() const
+    {
+        return this->index;
+    }
+};
+
+/// An expression that complements another expression
+template <typename Operand>
+struct BitMatrixComplement
+{
+    /// The expression to complement
+    Operand operand;
+
+    template <typename Fetch>
+    constexpr auto evaluate(const Fetch& fetch) const
+    {
+        auto value = this->operand.evaluate(fetch);
+
+        // Cast the complement back, because small integers are promoted to `int`
+        return static_cast<decltype(value)>(~value);
+    }
+
+    [[nodiscard]]
+    constexpr size_t getMaxRowIndex() const
+    {
+        return this->operand.getMaxRowIndex();
+    }
+};
+
+///
+/// An expression that combines two expressions with a bitwise operation
+///
+/// @tparam Operation Specify the operation, e.g. `BitwiseAndOperation`
+/// @tparam Lhs Specify the expression on the left hand side
+/// @tparam Rhs Specify the expression on the right hand side
+///
+template <typename Operation, typename Lhs, typename Rhs>
+struct BitMatrixCombination
+{
+    /// The expression on the left hand side
+    Lhs lhs;
+
+    /// The expression on the right hand side
+    Rhs rhs;
+
+    template <typename Fetch>
+    constexpr auto evaluate(const Fetch& fetch) const
+    {
+        return Operation::apply(this->lhs.evaluate(fetch), this->rhs.evaluate(fetch));
+    }
+
+    [[nodiscard]]
+    constexpr size_t getMaxRowIndex() const
+    {
+        return std::max(this->lhs.getMaxRowIndex(), this->rhs.getMaxRowIndex());
+    }
+};
+
+///
+/// Check whether the given type is an expression on the rows of a bit matrix
+///
+template <typename T>
+struct IsBitMatrixExpression : std::false_type {};
+
+template <>
+struct IsBitMatrixExpression<BitMatrixRow> : std::true_type {};
+
+template <typename Operand>
+struct IsBitMatrixExpression<BitMatrixComplement<Operand>> : std::true_type {};
+
+template <typename Operation, typename Lhs, typename Rhs>
+struct IsBitMatrixExpression<BitMatrixCombination<Operation, Lhs, Rhs>> : std::true_type {};
+
+/// Specify an expression on the rows of a bit matrix
+template <typename T>
+concept BitMatrixExpression = IsBitMatrixExpression<T>::value;
+
+// MARK: Operators
+
+template <typename Lhs, typename Rhs>
+requires BitMatrixExpression<Lhs> && BitMatrixExpression<Rhs>
+constexpr BitMatrixCombination<BitwiseAndOperation, Lhs, Rhs> operator&(const Lhs& lhs, const Rhs& rhs)
+{
+    return { lhs, rhs };
+}
+
+template <typename Lhs, typename Rhs>
+requires BitMatrixExpression<Lhs> && BitMatrixExpression<Rhs>
+constexpr BitMatrixCombination<BitwiseOrOperation, Lhs, Rhs> operator|(const Lhs& lhs, const Rhs& rhs)
+{
+    return { lhs, rhs };
+}
+
+template <typename Lhs, typename Rhs>
+requires BitMatrixExpression<Lhs> && BitMatrixExpression<Rhs>
+constexpr BitMatrixCombination<BitwiseXorOperation, Lhs, Rhs> operator^(const Lhs& lhs, const Rhs& rhs)
+{
+    return { lhs, rhs };
+}
+
+template <typename Operand>
+requires BitMatrixExpression<Operand>
+constexpr BitMatrixComplement<Operand> operator~(const Operand& operand)
+{
+    return { operand };
+}
+
+//
+// MARK: - Bit Matrix
+//
+
+///
+/// A bit matrix manages a fixed number of static bit vectors of the same length, one per row
+///
+/// Each row is typically an attribute of the same set of objects, e.g. whether each page is dirty,
+/// so that a boolean filter on the attributes is an expression on the rows.
+/// The rows are stored contiguously and can be modified as static bit vectors.
+/// An expression is evaluated one block at a time: Each block of the result is computed from the same block of each row
+/// and then either stored, counted or searched, so that no temporary bit vectors are created,
+/// and a search stops at the first block that has a set bit.
+///
+/// Example:
+///
+/// ```
+/// BitMatrix<3, 4096> matrix;
+///
+/// BitMatrixRow dirty(0), pinned(1), shared(2);
+///
+/// ssize_t page = matrix.findFirstSetBit((dirty & shared) | ~pinned);
+/// ```
+///
+/// @tparam NumRows Specify the number of rows
+/// @tparam NumBits Specify the number of bits in each row
+/// @tparam StorageUnit Specify the underlying integer type to store bits
+///
+template <size_t NumRows, size_t NumBits, typename StorageUnit = size_t>
+requires ExtendedUnsignedIntegral<StorageUnit>
+class BitMatrix
+{
+public:
+    /// The type of each row
+    using Row = StaticBitVector<NumBits, StorageUnit>;
+
+private:
+    /// Compile time constant that stores the number of bits stored in each `BitOptions` block
+    static constexpr size_t NumBitsPerOptionsBlock = Row::NumBitsPerOptionsBlock;
+
+    /// Compile time constant that stores the number of blocks in each row
+    static constexpr size_t NumOptionsBlocks = Row::NumOptionsBlocks;
+
+    static_assert(NumRows > 0, "A bit matrix must have at least one row.");
+
+    /// The rows
+    Row rows[NumRows];
+
+    ///
+    /// Check whether the given expression only refers to rows in this matrix
+    ///
+    /// @param expression An expression on the rows
+    /// @return `true` if the expression is valid, `false` otherwise.
+    ///
+    template <typename Expression>
+    bool isValidExpression(const Expression& expression) const
+    {
+        if (expression.getMaxRowIndex() >= NumRows)
+        {
+            perr("The expression refers to row %lu, but the matrix has %lu rows.", expression.getMaxRowIndex(), NumRows);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    ///
+    /// Evaluate the given expression on the block at the given index
+    ///
+    /// @param expression An expression on the rows
+    /// @param block Index of the block
+    /// @return The block of the result.
+    /// @note The nonexistent bits of the last block might be set if the expression complements a row.
+    ///
+    template <typename Expression>
+    inline StorageUnit evaluateBlock(const Expression& expression, size_t block) const
+    {
+        return expression.evaluate([this, block](size_t row) -> StorageUnit { return this->rows[row].blocks[block].flatten(); });
+    }
+
+    ///
+    /// Get the bit mask to zero out nonexistent bits in the last block
+    ///
+    /// @return A bit mask that has all existing bits in the last block set.
+    ///
+    static inline StorageUnit getLastBlockMask()
+    {
+        return BitMask<StorageUnit>::createWithLowBitsSet((NumBits - 1) % NumBitsPerOptionsBlock + 1);
+    }
+
+public:
+    /// Get the number of rows
+    [[nodiscard]]
+    static constexpr size_t getNumRows()
+    {
+        return NumRows;
+    }
+
+    /// Get the number of bits in each row
+    [[nodiscard]]
+    static constexpr size_t getNumBits()
+    {
+        return NumBits;
+    }
+
+    ///
+    /// Get the row at the given index
+    ///
+    /// @param index Index of the row
+    /// @return The row, which can be examined and modified as a static bit vector.
+    ///
+    [[nodiscard]]
+    inline Row& getRow(size_t index)
+    {
+        passert(index < NumRows, "The row index %lu is out of bounds.", index);
+
+        return this->rows[index];
+    }
+
+    ///
+    /// Get the row at the given index
+    ///
+    /// @param index Index of the row
+    /// @return The row.
+    ///
+    [[nodiscard]]
+    inline const Row& getRow(size_t index) const
+    {
+        passert(index < NumRows, "The row index %lu is out of bounds.", index);
+
+        return this->rows[index];
+    }
+
+    // MARK: Evaluate Expressions
+
+    ///
+    /// Evaluate the given expression
+    ///
+    /// @param expression An expression on the rows
+    /// @param result A bit vector that has each bit set on return if the expression is true at that bit index
+    /// @return `true` on success, `false` if the expression refers to a row that does not exist, in which case the result is left intact.
+    /// @note The result is passed by reference rather than returned, because a large bit vector does not fit on the kernel stack.
+    ///       It may be one of the rows, because each block of the result is computed before it is stored.
+    ///
+    template <typename Expression>
+    requires BitMatrixExpression<Expression>
+    bool evaluate(const Expression& expression, Row& result) const
+    {
+        // Guard: The expression refers to a row that does not exist
+        if (!this->isValidExpression(expression))
+        {
+            return false;
+        }
+
+        for (size_t block = 0; block < NumOptionsBlocks; block += 1)
+        {
+            result.blocks[block] = BitOptions<StorageUnit>(this->evaluateBlock(expression, block));
+        }
+
+        result.blocks[NumOptionsBlocks - 1].mutativeBitwiseAnd(getLastBlockMask());
+
+        return true;
+    }
+
+    ///
+    /// Count the number of bit indices at which the given expression is true
+    ///
+    /// @param expression An expression on the rows
+    /// @return The number of set bits in the result, or 0 if the expression refers to a row that does not exist.
+    ///
+    template <typename Expression>
+    requires BitMatrixExpression<Expression>
+    [[nodiscard]]
+    size_t count(const Expression& expression) const
+    {
+        // Guard: The expression refers to a row that does not exist
+        if (!this->isValidExpression(expression))
+        {
+            return 0;
+        }
+
+        size_t count = 0;
+
+        for (size_t block = 0; block + 1 < NumOptionsBlocks; block += 1)
+        {
+            count += BitOptions<StorageUnit>(this->evaluateBlock(expression, block)).count();
+        }
+
+        return count + BitOptions<StorageUnit>(this->evaluateBlock(expression, NumOptionsBlocks - 1) & getLastBlockMask()).count();
+    }
+
+    ///
+    /// Find the first bit index at or after the given index at which the given expression is true
+    ///
+    /// @param expression An expression on the rows
+    /// @param from Index of the bit where the search starts
+    /// @return The absolute index of the next set bit in the result on success,
+    ///         `-1` if no such bit exists or the expression refers to a row that does not exist.
+    /// @note The bit at `from` is included in the search.
+    ///
+    template <typename Expression>
+    requires BitMatrixExpression<Expression>
+    [[nodiscard]]
+    ssize_t findNextSetBit(const Expression& expression, size_t from) const
+    {
+        // Guard: The index is out of bounds or the expression refers to a row that does not exist
+        if (from >= NumBits || !this->isValidExpression(expression))
+        {
+            return -1;
+        }
+
+        size_t block = from / NumBitsPerOptionsBlock;
+
+        // Clear the bits before the given index in the first block
+        StorageUnit value = this->evaluateBlock(expression, block) & ~BitMask<StorageUnit>::createWithLowBitsSet(from % NumBitsPerOptionsBlock);
+
+        while (true)
+        {
+            if (block == NumOptionsBlocks - 1)
+            {
+                value &= getLastBlockMask();
+            }
+
+            if (value != 0)
+            {
+                return static_cast<ssize_t>(block * NumBitsPerOptionsBlock + BitOptions<StorageUnit>(value).findLeastSignificantBitIndex());
+            }
+
+            block += 1;
+
+            // Guard: All blocks have been examined
+            if (block == NumOptionsBlocks)
+            {
+                return -1;
+            }
+
+            value = this->evaluateBlock(expression, block);
+        }
+    }
+
+    ///
+    /// Find the first bit index at which the given expression is true
+    ///
+    /// @param expression An expression on the rows
+    /// @return The index of the first set bit in the result on success,
+    ///         `-1` if no such bit exists or the expression refers to a row that does not exist.
+    ///
+    template <typename Expression>
+    requires BitMatrixExpression<Expression>
+    [[nodiscard]]
+    ssize_t findFirstSetBit(const Expression& expression) const
+    {
+        return this->findNextSetBit(expression, 0);
+    }
+};
+
+#endif /* BitMatrix_hpp */
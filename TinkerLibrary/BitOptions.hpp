@@ -14,8 +14,10 @@
 
 #include <cstddef>
 #include <concepts>
+#include <iterator>
 #include "Debug.hpp"
 #include "SignificantBit.hpp"
+#include "BitPermutation.hpp"
 
 //
 // OSBitOptions - The original header
@@ -43,9 +45,10 @@
 /// @note It is recommended to use `uint8_t`, `uint16_t`, `uint32_t` and `uint64_t` as the storage type.
 ///       If variable size is desired, consider to use `size_t` or `unsigned long` instead.
 ///       By default, it uses the `size_t` type to best work with both 32-bit and 64-bit platforms.
+/// @note `UInt128` and `UInt256` are also supported for bit vectors that prefer fewer, wider blocks.
 ///
 template <typename T = size_t>
-requires std::unsigned_integral<T>
+requires ExtendedUnsignedIntegral<T>
 struct BitOptions
 {
 private:
@@ -56,32 +59,91 @@ public:
     /// An unsigned integer type that represents a single bit option
     using BitOption = T;
 
+    /// A forward iterator that visits the index of each set bit in ascending order
+    class SetBitIterator
+    {
+    private:
+        /// The set bits that have not been visited yet
+        T remaining;
+
+    public:
+        using value_type = uint32_t;
+        using difference_type = ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        /// Create an iterator that has visited all set bits
+        constexpr SetBitIterator() : remaining(0) {}
+
+        /// Create an iterator that visits the given set bits
+        constexpr explicit SetBitIterator(T remaining) : remaining(remaining) {}
+
+        /// Get the index of the current set bit
+        constexpr uint32_t operator*() const
+        {
+            return LSBFinder<T, sizeof(T)>()(this->remaining);
+        }
+
+        /// Advance to the next set bit by clearing the current one
+        constexpr SetBitIterator& operator++()
+        {
+            this->remaining &= this->remaining - 1;
+
+            return *this;
+        }
+
+        /// Advance to the next set bit by clearing the current one
+        constexpr SetBitIterator operator++(int)
+        {
+            SetBitIterator current = *this;
+
+            ++(*this);
+
+            return current;
+        }
+
+        /// Check whether two iterators have the same set bits left to visit
+        constexpr bool operator==(const SetBitIterator& other) const = default;
+    };
+
     ///
     /// Create a single bit option with the given bit index
     ///
     /// @param index The index of the bit
     /// @return The BitOption value.
+    /// @note An invalid index fails to compile if this function is evaluated in a constant expression.
     ///
-    static inline BitOption createOptionWithIndex(size_t index)
+    static constexpr BitOption createOptionWithIndex(size_t index)
     {
         passert(index < sizeof(T) * 8, "The given bit index is invalid.");
 
         return static_cast<T>(1) << index;
     }
 
-    /// Create a collection of bit options from the given raw value
-    /// By default, an empty collection of options is created.
-    explicit BitOptions(T options = 0)
+    ///
+    /// Create a single bit option with the given bit index that is checked at compile time
+    ///
+    /// @tparam Index The index of the bit
+    /// @return The BitOption value.
+    ///
+    template <size_t Index>
+    static consteval BitOption createOption()
     {
-        this->options = options;
+        static_assert(Index < sizeof(T) * 8, "The given bit index is invalid.");
+
+        return static_cast<T>(1) << Index;
     }
 
+    /// Create a collection of bit options from the given raw value
+    /// By default, an empty collection of options is created.
+    constexpr explicit BitOptions(T options = 0) : options(options) {}
+
     ///
     /// Insert the given option
     ///
     /// @param option An option to be inserted
     ///
-    inline void mutativeInsert(BitOption option)
+    constexpr void mutativeInsert(BitOption option)
     {
         this->options |= option;
     }
@@ -91,7 +153,7 @@ public:
     ///
     /// @param option An option to be removed
     ///
-    inline void mutativeRemove(BitOption option)
+    constexpr void mutativeRemove(BitOption option)
     {
         this->options &= (~option);
     }
@@ -101,7 +163,7 @@ public:
     ///
     /// @param option An option to be "and"ed
     ///
-    inline void mutativeBitwiseAnd(BitOption option)
+    constexpr void mutativeBitwiseAnd(BitOption option)
     {
         this->options &= option;
     }
@@ -111,7 +173,7 @@ public:
     ///
     /// @param option An option to be "or"ed
     ///
-    inline void mutativeBitwiseOr(BitOption option)
+    constexpr void mutativeBitwiseOr(BitOption option)
     {
         this->options |= option;
     }
@@ -123,7 +185,7 @@ public:
     /// @return The new options after the insertion
     ///
     [[nodiscard]]
-    inline BitOptions insert(BitOption option) const
+    constexpr BitOptions insert(BitOption option) const
     {
         return BitOptions(this->options | option);
     }
@@ -135,7 +197,7 @@ public:
     /// @return The new options after the removal
     ///
     [[nodiscard]]
-    inline BitOptions remove(BitOption option) const
+    constexpr BitOptions remove(BitOption option) const
     {
         return BitOptions(this->options & (~option));
     }
@@ -146,7 +208,7 @@ public:
     /// @param option An option to be "and"ed
     ///
     [[nodiscard]]
-    inline BitOptions bitwiseAnd(BitOption option) const
+    constexpr BitOptions bitwiseAnd(BitOption option) const
     {
         return BitOptions(this->options & option);
     }
@@ -157,7 +219,7 @@ public:
     /// @param option An option to be "or"ed
     ///
     [[nodiscard]]
-    inline BitOptions bitwiseOr(BitOption option) const
+    constexpr BitOptions bitwiseOr(BitOption option) const
     {
         return BitOptions(this->options | option);
     }
@@ -169,7 +231,7 @@ public:
     /// @return `true` if `this` contains the given `option`, `false` otherwise.
     ///
     [[nodiscard]]
-    inline bool contains(BitOption option) const
+    constexpr bool contains(BitOption option) const
     {
         return (this->options & option) == option;
     }
@@ -182,7 +244,7 @@ public:
     ///
     template <typename... Option>
     [[nodiscard]]
-    inline bool containsOneOf(Option... option) const
+    constexpr bool containsOneOf(Option... option) const
     {
         return (this->contains(option) || ...);
     }
@@ -195,7 +257,7 @@ public:
     ///
     template <typename... Option>
     [[nodiscard]]
-    inline bool containsAll(Option... option) const
+    constexpr bool containsAll(Option... option) const
     {
         return (this->contains(option) && ...);
     }
@@ -206,7 +268,7 @@ public:
     /// @return `true` if it is empty, `false` otherwise.
     ///
     [[nodiscard]]
-    inline bool isEmpty() const
+    constexpr bool isEmpty() const
     {
         return this->options == 0;
     }
@@ -217,7 +279,7 @@ public:
     /// @return The flatten version of this collection of options.
     ///
     [[nodiscard]]
-    inline BitOption flatten() const
+    constexpr BitOption flatten() const
     {
         return this->options;
     }
@@ -226,12 +288,12 @@ public:
     /// Find the position of the least significant bit
     ///
     /// @return Index of the least significant bit.
-    /// @note This function uses the de Bruijin Sequence to find LSB in a 32-bit/64-bit integer.
+    /// @note This function uses the `LSBFinder` that compiles to a single instruction on most targets.
     ///       The caller must ensure that `options` is not empty before calling this function.
     /// @warning This function returns 0 if options is empty.
     ///
     [[nodiscard]]
-    inline uint32_t findLeastSignificantBitIndex() const
+    constexpr uint32_t findLeastSignificantBitIndex() const
     {
         if (this->isEmpty())
         {
@@ -245,12 +307,12 @@ public:
     /// Find the position of the most significant bit
     ///
     /// @return Index of the most significant bit.
-    /// @note This function uses the de Bruijin Sequence to find MSB in a 32-bit/64-bit integer.
+    /// @note This function uses the `MSBFinder` that compiles to a single instruction on most targets.
     ///       The caller must ensure that `options` is not empty before calling this function.
     /// @warning This function returns 0 if options is empty.
     ///
     [[nodiscard]]
-    inline uint32_t findMostSignificantBitIndex() const
+    constexpr uint32_t findMostSignificantBitIndex() const
     {
         if (this->isEmpty())
         {
@@ -260,10 +322,61 @@ public:
         return MSBFinder<T, sizeof(T)>()(this->options);
     }
 
+    ///
+    /// Count the number of set bits
+    ///
+    /// @return The number of options in this collection.
+    ///
+    [[nodiscard]]
+    constexpr uint32_t count() const
+    {
+        return PopulationCounter<T>()(this->options);
+    }
+
+    ///
+    /// Find the position of the k-th set bit
+    ///
+    /// @param k Specify which set bit to find, starting from 0
+    /// @return Index of the k-th set bit, or the number of bits in `T` if there are no more than `k` set bits.
+    /// @note This function uses the `NthSetBitFinder` that compiles to `pdep` and `tzcnt` on targets with BMI2,
+    ///       so its cost does not depend on `k`, unlike clearing the lowest set bit `k` times.
+    ///
+    [[nodiscard]]
+    constexpr uint32_t findNthSetBitIndex(size_t k) const
+    {
+        return NthSetBitFinder<T>()(this->options, k);
+    }
+
+    ///
+    /// Gather the bits selected by the given mask into the low bits
+    ///
+    /// @param mask Specify which bits to gather
+    /// @return The new options that have the selected bits packed into the low `mask.count()` bits in order.
+    /// @note This function uses the `BitExtractor` that compiles to `pext` on targets with BMI2.
+    ///
+    [[nodiscard]]
+    constexpr BitOptions extract(BitOption mask) const
+    {
+        return BitOptions(BitExtractor<T>()(this->options, mask));
+    }
+
+    ///
+    /// Scatter the low bits to the positions selected by the given mask
+    ///
+    /// @param mask Specify where to scatter the low bits
+    /// @return The new options that have the low `mask.count()` bits moved to the selected positions in order.
+    /// @note This function uses the `BitDepositor` that compiles to `pdep` on targets with BMI2, and is the inverse of `extract()`.
+    ///
+    [[nodiscard]]
+    constexpr BitOptions deposit(BitOption mask) const
+    {
+        return BitOptions(BitDepositor<T>()(this->options, mask));
+    }
+
     ///
     /// Clear all bits
     ///
-    inline void clearAll()
+    constexpr void clearAll()
     {
         this->options = 0;
     }
@@ -271,9 +384,9 @@ public:
     ///
     /// Set all bits
     ///
-    inline void setAll()
+    constexpr void setAll()
     {
-        this->options = -1;
+        this->options = static_cast<T>(~static_cast<T>(0));
     }
 
     ///
@@ -283,7 +396,7 @@ public:
     /// @return `true` if the target bit is set, `false` otherwise.
     ///
     [[nodiscard]]
-    inline bool containsBit(size_t index) const
+    constexpr bool containsBit(size_t index) const
     {
         return this->contains(createOptionWithIndex(index));
     }
@@ -295,7 +408,7 @@ public:
     /// @return The bit at the given index.
     ///
     [[nodiscard]]
-    inline uint8_t getBit(size_t index) const
+    constexpr uint8_t getBit(size_t index) const
     {
         return this->containsBit(index) ? 1 : 0;
     }
@@ -305,7 +418,7 @@ public:
     ///
     /// @param index Index of the bit
     ///
-    inline void setBit(size_t index)
+    constexpr void setBit(size_t index)
     {
         this->mutativeInsert(createOptionWithIndex(index));
     }
@@ -315,13 +428,51 @@ public:
     ///
     /// @param index Index of the bit
     ///
-    inline void clearBit(size_t index)
+    constexpr void clearBit(size_t index)
     {
         this->mutativeRemove(createOptionWithIndex(index));
     }
 
+    ///
+    /// Get an iterator to the index of the least significant set bit
+    ///
+    /// @return An iterator that visits the index of each set bit in ascending order.
+    /// @note A collection of bit options can therefore be used in a range-based for loop over the index of its members.
+    ///
+    [[nodiscard]]
+    constexpr SetBitIterator begin() const
+    {
+        return SetBitIterator(this->options);
+    }
+
+    ///
+    /// Get an iterator past the index of the most significant set bit
+    ///
+    /// @return An iterator that has visited all set bits.
+    ///
+    [[nodiscard]]
+    constexpr SetBitIterator end() const
+    {
+        return SetBitIterator();
+    }
+
+    ///
+    /// Call the given action on the index of each set bit in ascending order
+    ///
+    /// @param action A functor that takes the index of each set bit
+    ///
+    template <typename Action>
+    requires std::invocable<Action, uint32_t> && std::same_as<std::invoke_result_t<Action, uint32_t>, void>
+    constexpr void forEachSetBit(Action action) const
+    {
+        for (T remaining = this->options; remaining != 0; remaining &= remaining - 1)
+        {
+            action(LSBFinder<T, sizeof(T)>()(remaining));
+        }
+    }
+
     /// Perform the bitwise AND and the assignment operation
-    BitOptions& operator&=(const BitOptions& rhs)
+    constexpr BitOptions& operator&=(const BitOptions& rhs)
     {
         this->options &= rhs.options;
 
@@ -329,7 +480,7 @@ public:
     }
 
     /// Perform the bitwise OR and the assignment operation
-    BitOptions& operator|=(const BitOptions& rhs)
+    constexpr BitOptions& operator|=(const BitOptions& rhs)
     {
         this->options |= rhs.options;
 
@@ -337,16 +488,19 @@ public:
     }
 
     /// Perform the bitwise AND operation
-    BitOptions operator&(const BitOptions& rhs)
+    constexpr BitOptions operator&(const BitOptions& rhs) const
     {
         return BitOptions(this->options & rhs.options);
     }
 
-    /// Perform the bitwise AND operation
-    BitOptions operator|(const BitOptions& rhs)
+    /// Perform the bitwise OR operation
+    constexpr BitOptions operator|(const BitOptions& rhs) const
     {
         return BitOptions(this->options | rhs.options);
     }
+
+    /// Check whether two collections have the same options
+    constexpr bool operator==(const BitOptions& rhs) const = default;
 };
 
 #endif /* BitOptions_h */
@@ -0,0 +1,333 @@
+//
+//  BitPermutation.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitPermutation_hpp
+#define BitPermutation_hpp
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "SignificantBit.hpp"
+
+//
+// MARK: - Backend Selection
+//
+// The functors below use the BMI2 instructions `pdep` and `pext` when the target supports them at build time (e.g. `-mbmi2`),
+// and fall back to the portable broadword implementation otherwise, as well as in constant expressions.
+// Define `BIT_PERMUTATION_PORTABLE` to always use the portable implementation,
+// e.g. on AMD processors prior to Zen 3, which implement both instructions in microcode with a latency proportional to the number of set bits.
+//
+#if defined(__BMI2__) && defined(__x86_64__) && !defined(BIT_PERMUTATION_PORTABLE)
+    #include <immintrin.h>
+    #define BIT_PERMUTATION_BMI2 1
+#endif
+
+//
+// MARK: - Portable Implementation
+//
+// Native integers of up to 64 bits are zero extended to 64 bits, which does not change any of the results.
+// The compress and expand algorithms come from Hacker's Delight (2nd Edition), Section 7-4 and 7-5:
+// Each round moves bits by a power of 2 at once rather than moving one bit at a time, so an N-bit integer takes log2(N) rounds.
+//
+
+/// Private functor to find the index of the k-th set bit in a 64-bit integer without BMI2 instructions
+/// @note The functor runs in constant time without branches except for the guards, like the broadword select by Sebastiano Vigna.
+struct PortableNthSetBitFinder
+{
+    ///
+    /// Count the number of bytes in the given sums of bits that are not greater than the given value
+    ///
+    /// @param sums Eight ascending sums of bits, one in each byte, each of which is at most 64
+    /// @param k A value less than 64
+    /// @return The number of bytes whose sum is not greater than `k`, which is also the index of the first byte whose sum is greater than `k`.
+    ///
+    static constexpr uint32_t countBytesNotGreaterThan(uint64_t sums, uint64_t k)
+    {
+        // Setting the high bit of each byte prevents borrows across bytes,
+        // and the high bit remains set if and only if the sum is greater than `k`.
+        uint64_t greater = ((sums | 0x8080808080808080ULL) - (k + 1) * 0x0101010101010101ULL) & 0x8080808080808080ULL;
+
+        // Add up the high bits in the high byte
+        return 8 - static_cast<uint32_t>(((greater >> 7) * 0x0101010101010101ULL) >> 56);
+    }
+
+    constexpr uint32_t operator()(uint64_t value, size_t k)
+    {
+        // Guard: The integer has no more than `k` set bits
+        if (k >= 64)
+        {
+            return 64;
+        }
+
+        // Count bits in each byte as in `PopulationCounter`, and then sum them up, so that byte `i` has the number of set bits in bytes 0 to `i`
+        uint64_t bytes = value - ((value >> 1) & 0x5555555555555555ULL);
+
+        bytes = (bytes & 0x3333333333333333ULL) + ((bytes >> 2) & 0x3333333333333333ULL);
+
+        bytes = (bytes + (bytes >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+        uint64_t sums = bytes * 0x0101010101010101ULL;
+
+        // Find the byte that has the k-th set bit
+        uint32_t byte = countBytesNotGreaterThan(sums, k);
+
+        // Guard: No sum is greater than `k`, so the integer has no more than `k` set bits
+        if (byte == 8)
+        {
+            return 64;
+        }
+
+        // Shifting the sums by a byte yields the number of set bits in the bytes before each byte
+        uint64_t rank = k - (((sums << 8) >> (byte * 8)) & 0xFF);
+
+        // Spread the bits of the byte to the low bit of each byte, and then find the byte that has the remaining rank in the same way
+        uint64_t spread = ((value >> (byte * 8)) & 0xFF) * 0x0101010101010101ULL & 0x8040201008040201ULL;
+
+        uint64_t ones = ((spread + 0x7F7F7F7F7F7F7F7FULL) & 0x8080808080808080ULL) >> 7;
+
+        return byte * 8 + countBytesNotGreaterThan(ones * 0x0101010101010101ULL, rank);
+    }
+};
+
+///
+/// Private function to compute the parallel suffix (i.e. the prefix XOR from the low end) used by the compress and expand algorithms
+///
+/// @tparam NumBits Specify the number of low bits that are significant
+///
+template <size_t NumBits>
+static constexpr uint64_t computeParallelSuffix(uint64_t value)
+{
+    for (size_t shift = 1; shift < NumBits; shift <<= 1)
+    {
+        value ^= value << shift;
+    }
+
+    return value;
+}
+
+///
+/// Private functor to gather the bits selected by a mask into the low bits of an integer without BMI2 instructions
+///
+/// @tparam NumBits Specify the integer width, which determines the number of rounds
+///
+template <size_t NumBits = 64>
+struct PortableBitExtractor
+{
+    constexpr uint64_t operator()(uint64_t value, uint64_t mask)
+    {
+        value &= mask;
+
+        // Bits that have a zero bit on their right within the mask, which must move to the right
+        uint64_t moves = ~mask << 1;
+
+        for (size_t shift = 1; shift < NumBits; shift <<= 1)
+        {
+            // Bits whose number of zero bits on their right has the current power of 2 set
+            uint64_t parallelSuffix = computeParallelSuffix<NumBits>(moves);
+
+            uint64_t movingMask = parallelSuffix & mask;
+
+            mask = (mask ^ movingMask) | (movingMask >> shift);
+
+            uint64_t movingBits = value & movingMask;
+
+            value = (value ^ movingBits) | (movingBits >> shift);
+
+            moves &= ~parallelSuffix;
+        }
+
+        return value;
+    }
+};
+
+///
+/// Private functor to scatter the low bits of an integer to the positions selected by a mask without BMI2 instructions
+///
+/// @tparam NumBits Specify the integer width, which determines the number of rounds
+///
+template <size_t NumBits = 64>
+struct PortableBitDepositor
+{
+    constexpr uint64_t operator()(uint64_t value, uint64_t mask)
+    {
+        // Record the bits moved by each round of compressing the mask, and then undo the rounds on the value in reverse order
+        uint64_t movingMasks[6] = {};
+
+        uint64_t original = mask;
+
+        uint64_t moves = ~mask << 1;
+
+        size_t round = 0;
+
+        for (size_t shift = 1; shift < NumBits; shift <<= 1, round += 1)
+        {
+            uint64_t parallelSuffix = computeParallelSuffix<NumBits>(moves);
+
+            movingMasks[round] = parallelSuffix & mask;
+
+            mask = (mask ^ movingMasks[round]) | (movingMasks[round] >> shift);
+
+            moves &= ~parallelSuffix;
+        }
+
+        while (round-- > 0)
+        {
+            value = (value & ~movingMasks[round]) | ((value << (1u << round)) & movingMasks[round]);
+        }
+
+        return value & original;
+    }
+};
+
+//
+// MARK: - Functors
+//
+
+///
+/// Functor to find the index of the k-th set bit in an integer
+///
+/// @note `k` starts from 0, so that the 0-th set bit is the LSB.
+/// @note The functor returns the integer width if the integer has no more than `k` set bits.
+///
+template <typename T = size_t>
+requires ExtendedUnsignedIntegral<T>
+struct NthSetBitFinder
+{
+    constexpr uint32_t operator()(T value, size_t k)
+    {
+        // Wide integers: Skip the 64-bit words that have no more than `k` set bits in total
+        if constexpr (sizeof(T) > sizeof(uint64_t))
+        {
+            for (size_t index = 0; index < sizeof(T) / sizeof(uint64_t); index += 1)
+            {
+                uint64_t word = getWideIntegerWord(value, index);
+
+                uint32_t count = PopulationCounter<uint64_t>()(word);
+
+                if (k < count)
+                {
+                    return static_cast<uint32_t>(index * 64) + NthSetBitFinder<uint64_t>()(word, k);
+                }
+
+                k -= count;
+            }
+
+            return sizeof(T) * 8;
+        }
+        else
+        {
+#if defined(BIT_PERMUTATION_BMI2)
+            if (!std::is_constant_evaluated())
+            {
+                // Guard: Shifting by the integer width or more is undefined
+                if (k >= sizeof(T) * 8)
+                {
+                    return sizeof(T) * 8;
+                }
+
+                // Deposit a single bit to the position of the k-th set bit
+                uint64_t bit = _pdep_u64(1ULL << k, value);
+
+                return bit == 0 ? sizeof(T) * 8 : LSBFinder<uint64_t>()(bit);
+            }
+#endif
+            uint32_t index = PortableNthSetBitFinder()(value, k);
+
+            return index == 64 ? sizeof(T) * 8 : index;
+        }
+    }
+};
+
+///
+/// Functor to gather the bits selected by a mask into the low bits of an integer
+///
+/// @note For example, extracting 0b10110010 with the mask 0b11110000 yields 0b1011.
+/// @note This is the `pext` instruction of BMI2, also known as the compress operation.
+///
+template <typename T = size_t>
+requires ExtendedUnsignedIntegral<T>
+struct BitExtractor
+{
+    constexpr T operator()(T value, T mask)
+    {
+        // Wide integers: Extract each 64-bit word and concatenate the results
+        if constexpr (sizeof(T) > sizeof(uint64_t))
+        {
+            T result = 0;
+
+            size_t offset = 0;
+
+            for (size_t index = 0; index < sizeof(T) / sizeof(uint64_t); index += 1)
+            {
+                uint64_t word = getWideIntegerWord(mask, index);
+
+                result |= static_cast<T>(BitExtractor<uint64_t>()(getWideIntegerWord(value, index), word)) << offset;
+
+                offset += PopulationCounter<uint64_t>()(word);
+            }
+
+            return result;
+        }
+        else
+        {
+#if defined(BIT_PERMUTATION_BMI2)
+            if (!std::is_constant_evaluated())
+            {
+                return static_cast<T>(_pext_u64(value, mask));
+            }
+#endif
+            return static_cast<T>(PortableBitExtractor<sizeof(T) * 8>()(value, mask));
+        }
+    }
+};
+
+///
+/// Functor to scatter the low bits of an integer to the positions selected by a mask
+///
+/// @note For example, depositing 0b1011 with the mask 0b11110000 yields 0b10110000.
+/// @note This is the `pdep` instruction of BMI2, also known as the expand operation, and is the inverse of `BitExtractor`.
+///
+template <typename T = size_t>
+requires ExtendedUnsignedIntegral<T>
+struct BitDepositor
+{
+    constexpr T operator()(T value, T mask)
+    {
+        // Wide integers: Deposit the next low bits of the value into each 64-bit word
+        if constexpr (sizeof(T) > sizeof(uint64_t))
+        {
+            T result = 0;
+
+            size_t offset = 0;
+
+            for (size_t index = 0; index < sizeof(T) / sizeof(uint64_t); index += 1)
+            {
+                uint64_t word = getWideIntegerWord(mask, index);
+
+                // The offset never exceeds the number of bits in the preceding words, so the shift is always valid
+                result |= static_cast<T>(BitDepositor<uint64_t>()(static_cast<uint64_t>(value >> offset), word)) << (index * 64);
+
+                offset += PopulationCounter<uint64_t>()(word);
+            }
+
+            return result;
+        }
+        else
+        {
+#if defined(BIT_PERMUTATION_BMI2)
+            if (!std::is_constant_evaluated())
+            {
+                return static_cast<T>(_pdep_u64(value, mask));
+            }
+#endif
+            return static_cast<T>(PortableBitDepositor<sizeof(T) * 8>()(value, mask));
+        }
+    }
+};
+
+#endif /* BitPermutation_hpp */
@@ -0,0 +1,70 @@
+//
+//  BitVectorAllocator.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitVectorAllocator_hpp
+#define BitVectorAllocator_hpp
+
+#include <cstddef>
+#include <concepts>
+#include <new>
+
+/// A type that allocates and releases raw memory for bit vectors whose storage is only known at runtime
+template <typename Allocator>
+concept BitVectorAllocator = requires(Allocator& allocator, void* pointer, size_t size)
+{
+    { allocator.allocate(size) } -> std::same_as<void*>;
+    { allocator.deallocate(pointer, size) };
+};
+
+///
+/// An allocator that never allocates memory
+///
+/// A dynamic bit vector that uses this allocator is confined to the buffer supplied by the caller.
+///
+struct NullBitVectorAllocator
+{
+    /// Always fail to allocate memory
+    void* allocate(size_t size)
+    {
+        (void) size;
+
+        return nullptr;
+    }
+
+    /// Never called, because nothing is allocated
+    void deallocate(void* pointer, size_t size)
+    {
+        (void) pointer;
+
+        (void) size;
+    }
+};
+
+///
+/// An allocator that takes memory from the global `operator new`
+///
+/// @note In the kernel, the global `operator new` is routed to `kmalloc()` if dynamic memory allocations are enabled.
+///
+struct HeapBitVectorAllocator
+{
+    /// Allocate the given number of bytes
+    void* allocate(size_t size)
+    {
+        return ::operator new(size);
+    }
+
+    /// Release the memory returned by `allocate()`
+    void deallocate(void* pointer, size_t size)
+    {
+        (void) size;
+
+        ::operator delete(pointer);
+    }
+};
+
+#endif /* BitVectorAllocator_hpp */
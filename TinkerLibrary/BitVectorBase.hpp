@@ -0,0 +1,1250 @@
+//
+//  BitVectorBase.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitVectorBase_hpp
+#define BitVectorBase_hpp
+
+#include <iterator>
+#include "BitOptions.hpp"
+#include "BitMasks.hpp"
+#include "ClosedRange.hpp"
+#include "BitwiseKernels.hpp"
+#include "Debug.hpp"
+
+///
+/// The common implementation of bit vectors that store bits in an array of `BitOptions` blocks
+///
+/// The base class implements searching, range manipulation, counting and iteration once,
+/// while the derived class decides where the blocks live and how many bits the vector has.
+/// A derived class must provide the following members to the base class:
+///
+/// - `blocks`: An array of or a pointer to the `BitOptions<StorageUnit>` blocks
+/// - `getNumBits()`: The total number of bits, which is a compile time constant for static bit vectors
+///
+/// Nonexistent bits in the last block must always be zero.
+///
+/// @tparam Derived Specify the concrete bit vector type
+/// @tparam StorageUnit Specify the underlying integer type to store bits, which may be wider than 64 bits (e.g. `UInt256`)
+///
+template <typename Derived, typename StorageUnit>
+requires ExtendedUnsignedIntegral<StorageUnit>
+class BitVectorBase
+{
+protected:
+    /// Compile time constant that stores the number of bits stored in each `BitOptions` block
+    static constexpr size_t NumBitsPerOptionsBlock = sizeof(StorageUnit) * 8;
+
+    /// The native integer type that bulk bitwise kernels operate on, which splits a wide storage unit into 64-bit words
+    using KernelUnit = std::conditional_t<(sizeof(StorageUnit) > sizeof(uint64_t)), uint64_t, StorageUnit>;
+
+    /// Compile time constant that stores the number of kernel units in each `BitOptions` block
+    static constexpr size_t NumKernelUnitsPerBlock = sizeof(StorageUnit) / sizeof(KernelUnit);
+
+    /// Get the concrete bit vector
+    constexpr Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+
+    /// Get the concrete bit vector
+    constexpr const Derived& derived() const
+    {
+        return static_cast<const Derived&>(*this);
+    }
+
+    /// Get the total number of bits
+    constexpr size_t getNumBits() const
+    {
+        return this->derived().getNumBits();
+    }
+
+    /// Get the number of blocks that store the bits
+    constexpr size_t getNumBlocks() const
+    {
+        return (this->getNumBits() + NumBitsPerOptionsBlock - 1) / NumBitsPerOptionsBlock;
+    }
+
+    /// Get the blocks that store the bits
+    constexpr BitOptions<StorageUnit>* getBlocks()
+    {
+        return this->derived().blocks;
+    }
+
+    /// Get the blocks that store the bits
+    constexpr const BitOptions<StorageUnit>* getBlocks() const
+    {
+        return this->derived().blocks;
+    }
+
+    ///
+    /// Get the bit mask to zero out nonexistent bits in the last block
+    ///
+    /// @return A bit mask that has all existing bits in the last block set.
+    ///
+    constexpr StorageUnit getLastBlockMask() const
+    {
+        return BitMask<StorageUnit>::createWithLowBitsSet((this->getNumBits() - 1) % NumBitsPerOptionsBlock + 1);
+    }
+
+    ///
+    /// Retrieve the block and the offset from the given bit index
+    ///
+    /// @param index The bit index
+    /// @param block The block index on return
+    /// @param offset The offset into the `block` on return
+    /// @return `true` if the given index is valid, `false` otherwise.
+    ///
+    constexpr bool index2BlockOffset(size_t index, size_t& block, size_t& offset) const
+    {
+        // Guard: Ensure that the index is not out-of-bound
+        if (index >= this->getNumBits())
+        {
+            return false;
+        }
+
+        // Retrieve the block number and the offset in that block
+        block = index / NumBitsPerOptionsBlock;
+
+        offset = index % NumBitsPerOptionsBlock;
+
+        return true;
+    }
+
+    ///
+    /// Retrieve the first and the last block and their offsets from the given range
+    ///
+    /// @param range The range of bits
+    /// @param fblock The index of the first block on return
+    /// @param foffset The offset into the first block on return
+    /// @param lblock The index of the last block on return
+    /// @param loffset The offset into the last block on return
+    /// @return `true` if the given range is valid, `false` otherwise.
+    ///
+    template <typename Bound>
+    constexpr bool range2BlockOffsets(ClosedRange<Bound> range, size_t& fblock, size_t& foffset, size_t& lblock, size_t& loffset) const
+    {
+        if (!this->index2BlockOffset(range.lowerBound, fblock, foffset))
+        {
+            perr("The lower bound %lu of the given range [%lu, %lu] is not valid.", range.lowerBound, range.lowerBound, range.upperBound);
+
+            return false;
+        }
+
+        if (!this->index2BlockOffset(range.upperBound, lblock, loffset))
+        {
+            perr("The upper bound %lu of the given range [%lu, %lu] is not valid.", range.upperBound, range.lowerBound, range.upperBound);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    ///
+    /// Get the block at the given index prepared for searching
+    ///
+    /// @tparam Complement Pass `true` to search for zero bits, i.e. to complement the block
+    /// @param index Index of the block
+    /// @return The block itself, or its complement with nonexistent bits in the last block cleared.
+    ///
+    template <bool Complement>
+    [[nodiscard]]
+    inline BitOptions<StorageUnit> getSearchBlock(size_t index) const
+    {
+        if constexpr (!Complement)
+        {
+            return this->getBlocks()[index];
+        }
+        else
+        {
+            BitOptions<StorageUnit> options(static_cast<StorageUnit>(~this->getBlocks()[index].flatten()));
+
+            // Guard: Zero out "nonexistent" bits so that they are never reported as zero bits
+            if (index == this->getNumBlocks() - 1)
+            {
+                options.mutativeBitwiseAnd(this->getLastBlockMask());
+            }
+
+            return options;
+        }
+    }
+
+    ///
+    /// Find the position of the first set bit (or zero bit if `Complement` is `true`) between the given positions
+    ///
+    /// @tparam Complement Pass `true` to search for zero bits, `false` to search for set bits
+    /// @param fblock Index of the first block
+    /// @param foffset Offset of the first bit in the first block
+    /// @param lblock Index of the last block
+    /// @param loffset Offset of the last bit in the last block
+    /// @return The absolute index of the first bit found on success, `-1` if no such bit exists.
+    /// @note This function examines a whole block at a time and uses the `LSBFinder` to locate the bit in a block.
+    ///
+    template <bool Complement>
+    [[nodiscard]]
+    ssize_t findFirstBitIndex(size_t fblock, size_t foffset, size_t lblock, size_t loffset) const
+    {
+        for (size_t index = fblock; index <= lblock; index += 1)
+        {
+            BitOptions<StorageUnit> options = this->getSearchBlock<Complement>(index);
+
+            // Clear out-of-bounds bits in the first and the last block
+            if (index == fblock)
+            {
+                options.mutativeBitwiseAnd(BitMask<StorageUnit>::createWithLowBitsClear(foffset));
+            }
+
+            if (index == lblock)
+            {
+                options.mutativeBitwiseAnd(BitMask<StorageUnit>::createWithLowBitsSet(loffset + 1));
+            }
+
+            // Guard: Skip the current block if it is empty
+            if (options.isEmpty())
+            {
+                continue;
+            }
+
+            return index * NumBitsPerOptionsBlock + options.findLeastSignificantBitIndex();
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Set or clear all bits between the given positions
+    ///
+    /// @tparam Value Pass `true` to set bits, `false` to clear bits
+    /// @param fblock Index of the first block
+    /// @param foffset Offset of the first bit in the first block
+    /// @param lblock Index of the last block
+    /// @param loffset Offset of the last bit in the last block
+    /// @note This function masks the partial first and last blocks and fills each middle block in one store.
+    ///
+    template <bool Value>
+    constexpr void fillBits(size_t fblock, size_t foffset, size_t lblock, size_t loffset)
+    {
+        // Guard: Check whether the first and the last block are the same
+        if (fblock == lblock)
+        {
+            this->fillBlock<Value>(fblock, BitMask<StorageUnit>::createWithRangeOfBitsSet(ClosedRange<size_t>(foffset, loffset)));
+
+            return;
+        }
+
+        // The first block: Bits from `foffset` to the end of the block
+        this->fillBlock<Value>(fblock, BitMask<StorageUnit>::createWithRangeOfBitsSet(ClosedRange<size_t>(foffset, NumBitsPerOptionsBlock - 1)));
+
+        // The middle blocks: All bits
+        for (size_t index = fblock + 1; index < lblock; index += 1)
+        {
+            if constexpr (Value)
+            {
+                this->getBlocks()[index].setAll();
+            }
+            else
+            {
+                this->getBlocks()[index].clearAll();
+            }
+        }
+
+        // The last block: Bits from the beginning of the block to `loffset`
+        this->fillBlock<Value>(lblock, BitMask<StorageUnit>::createWithRangeOfBitsSet(ClosedRange<size_t>(0, loffset)));
+    }
+
+    ///
+    /// Set or clear the bits selected by the given mask in a block
+    ///
+    /// @tparam Value Pass `true` to set bits, `false` to clear bits
+    /// @param index Index of the block
+    /// @param mask Specify which bits in the block should be set or cleared
+    ///
+    template <bool Value>
+    constexpr void fillBlock(size_t index, StorageUnit mask)
+    {
+        if constexpr (Value)
+        {
+            this->getBlocks()[index].mutativeInsert(mask);
+        }
+        else
+        {
+            this->getBlocks()[index].mutativeRemove(mask);
+        }
+    }
+
+    ///
+    /// Get the internal storage as an array of integers
+    ///
+    /// @return A pointer to the first kernel unit.
+    /// @note Bulk bitwise kernels operate on the underlying integers directly.
+    ///
+    inline KernelUnit* storage()
+    {
+        static_assert(sizeof(BitOptions<StorageUnit>) == sizeof(StorageUnit), "BitOptions must have the same layout as its storage unit.");
+
+        return reinterpret_cast<KernelUnit*>(this->getBlocks());
+    }
+
+    ///
+    /// Get the internal storage as an array of integers
+    ///
+    /// @return A pointer to the first kernel unit.
+    ///
+    inline const KernelUnit* storage() const
+    {
+        return reinterpret_cast<const KernelUnit*>(this->getBlocks());
+    }
+
+    /// Get the number of kernel units that store the bits
+    inline size_t getNumKernelUnits() const
+    {
+        return this->getNumBlocks() * NumKernelUnitsPerBlock;
+    }
+
+    ///
+    /// Check whether the given bit vector has the same number of bits as this one
+    ///
+    /// @param other Another bit vector
+    /// @return `true` if both vectors have the same number of bits, `false` otherwise.
+    ///
+    inline bool hasSameNumBits(const Derived& other) const
+    {
+        if (this->getNumBits() != other.getNumBits())
+        {
+            perr("The given bit vector has %lu bits, but this bit vector has %lu bits.", other.getNumBits(), this->getNumBits());
+
+            return false;
+        }
+
+        return true;
+    }
+
+public:
+    /// A forward iterator that visits the index of each set bit in ascending order
+    class SetBitIterator
+    {
+    private:
+        /// The blocks being iterated
+        const BitOptions<StorageUnit>* blocks;
+
+        /// The number of blocks being iterated
+        size_t numBlocks;
+
+        /// Index of the current block
+        size_t block;
+
+        /// The set bits in the current block that have not been visited yet
+        StorageUnit remaining;
+
+        /// Advance to the next non-empty block if all set bits in the current block have been visited
+        inline void skipEmptyBlocks()
+        {
+            while (this->remaining == 0 && this->block < this->numBlocks)
+            {
+                this->block += 1;
+
+                if (this->block < this->numBlocks)
+                {
+                    this->remaining = this->blocks[this->block].flatten();
+                }
+            }
+        }
+
+    public:
+        using value_type = size_t;
+        using difference_type = ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        /// Create an iterator that has visited all set bits
+        SetBitIterator() : blocks(nullptr), numBlocks(0), block(0), remaining(0) {}
+
+        /// Create an iterator that visits set bits in the given blocks starting from the given block
+        SetBitIterator(const BitOptions<StorageUnit>* blocks, size_t numBlocks, size_t block) :
+            blocks(blocks), numBlocks(numBlocks), block(block), remaining(block < numBlocks ? blocks[block].flatten() : 0)
+        {
+            this->skipEmptyBlocks();
+        }
+
+        /// Get the index of the current set bit
+        inline size_t operator*() const
+        {
+            return this->block * NumBitsPerOptionsBlock + BitOptions<StorageUnit>(this->remaining).findLeastSignificantBitIndex();
+        }
+
+        /// Advance to the next set bit
+        inline SetBitIterator& operator++()
+        {
+            // Clear the current bit within the block, and then move to the next non-empty block if necessary
+            this->remaining &= this->remaining - 1;
+
+            this->skipEmptyBlocks();
+
+            return *this;
+        }
+
+        /// Advance to the next set bit
+        inline SetBitIterator operator++(int)
+        {
+            SetBitIterator current = *this;
+
+            ++(*this);
+
+            return current;
+        }
+
+        /// Check whether two iterators point to the same set bit
+        inline bool operator==(const SetBitIterator& other) const
+        {
+            return this->block == other.block && this->remaining == other.remaining;
+        }
+    };
+
+    // MARK: Initialize a Bit Vector
+
+    /// Initialize the bit vector with all zeros
+    void initWithZeros()
+    {
+        pinfo("Initialized with NumBits = %lu; Storage Unit Size = %lu; NumOptions = %lu.", this->getNumBits(), sizeof(StorageUnit), this->getNumBlocks());
+
+        for (size_t index = 0; index < this->getNumBlocks(); index += 1)
+        {
+            this->getBlocks()[index].clearAll();
+        }
+    }
+
+    /// Initialize the bit vector with all ones
+    void initWithOnes()
+    {
+        pinfo("Initialized with NumBits = %lu; Storage Unit Size = %lu; NumOptions = %lu.", this->getNumBits(), sizeof(StorageUnit), this->getNumBlocks());
+
+        // Guard: The vector has no bits
+        if (this->getNumBits() == 0)
+        {
+            return;
+        }
+
+        for (size_t index = 0; index < this->getNumBlocks(); index += 1)
+        {
+            this->getBlocks()[index].setAll();
+        }
+
+        // Zero out "nonexistent" bits
+        this->getBlocks()[this->getNumBlocks() - 1].mutativeBitwiseAnd(this->getLastBlockMask());
+    }
+
+    // MARK: Examine a bit in the vector
+
+    ///
+    /// Check whether the given bit is set in the vector
+    ///
+    /// @param index Index of the bit
+    /// @return `true` if the bit at the given index is set, `false` otherwise.
+    /// @warning The given index must be less than the total number of bits, otherwise `false` is returned.
+    ///
+    [[nodiscard]]
+    constexpr bool containsBit(size_t index) const
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (!this->index2BlockOffset(index, block, offset))
+        {
+            return false;
+        }
+
+        // Check the bit
+        return this->getBlocks()[block].containsBit(offset);
+    }
+
+    ///
+    /// Get the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The bit at the given index.
+    /// @warning This function returns 0 if the given index is invalid.
+    ///
+    [[nodiscard]]
+    constexpr uint8_t getBit(size_t index) const
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (!this->index2BlockOffset(index, block, offset))
+        {
+            return 0;
+        }
+
+        // Get the bit
+        return this->getBlocks()[block].getBit(offset);
+    }
+
+    ///
+    /// Set the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    constexpr void setBit(size_t index)
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (this->index2BlockOffset(index, block, offset))
+        {
+            // Set the bit
+            this->getBlocks()[block].setBit(offset);
+        }
+    }
+
+    ///
+    /// Clear the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    constexpr void clearBit(size_t index)
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (this->index2BlockOffset(index, block, offset))
+        {
+            // Clear the bit
+            this->getBlocks()[block].clearBit(offset);
+        }
+    }
+
+    ///
+    /// Find the position of the least significant bit
+    ///
+    /// @return Index of the least significant bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    ssize_t findLeastSignificantBitIndex() const
+    {
+        // Block Array:
+        // --- Block 0 --- | --- Block 1 --- | ... | --- Block N --- |
+        // _ _ _ _ _ _ _ _ | _ _ _ _ _ _ _ _ |
+        // 7 6 5 4 3 2 1 0   F E D C B A 9 8 |
+        for (size_t index = 0; index < this->getNumBlocks(); index += 1)
+        {
+            // Guard: Skip the current block if it is empty
+            if (this->getBlocks()[index].isEmpty())
+            {
+                continue;
+            }
+
+            // The current block is not empty
+            // Retrieve the index of the LSB in this block
+            uint32_t offset = this->getBlocks()[index].findLeastSignificantBitIndex();
+
+            return index * NumBitsPerOptionsBlock + offset;
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Find the position of the least significant bit in the given range
+    ///
+    /// @param range Specify the range when searching for the least significant bit
+    /// @return The absolute index of the least significant bit on success, `-1` if no such bit exists.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    ssize_t findLeastSignificantBitIndexWithRange(ClosedRange<Bound> range) const
+    {
+        // Block Array:
+        // --- Block 0 --- | --- Block 1 --- | ... | --- Block N --- |
+        // _ _ _ _ _ _ _ _ | _ _ _ _ _ _ _ _ |
+        // 7 6 5 4 3 2 1 0   F E D C B A 9 8 |
+        // Supposed that the range is [5, 12],
+        // First find the first block and the last block in the range.
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->index2BlockOffset(range.lowerBound, fblock, foffset))
+        {
+            perr("The lower bound %lu of the given range [%lu, %lu] is not valid.", range.lowerBound, range.lowerBound, range.upperBound);
+
+            return -1;
+        }
+
+        if (!this->index2BlockOffset(range.upperBound, lblock, loffset))
+        {
+            perr("The upper bound %lu of the given range [%lu, %lu] is not valid.", range.upperBound, range.lowerBound, range.upperBound);
+
+            return -1;
+        }
+
+        // Guard: Check whether the first and the last block are the same
+        if (fblock == lblock)
+        {
+            StorageUnit mask = BitMask<StorageUnit>::createWithRangeOfBitsSet({foffset, loffset});
+
+            BitOptions<StorageUnit> options = this->getBlocks()[fblock].bitwiseAnd(mask);
+
+            if (options.isEmpty())
+            {
+                return -1;
+            }
+            else
+            {
+                return fblock * NumBitsPerOptionsBlock + options.findLeastSignificantBitIndex();
+            }
+        }
+
+        // Then make a copy of these two blocks and clear out-of-bounds bits
+        // --- Block 0 --- | --- Block 1 --- | ... | --- Block N --- |
+        // _ _ _ _ _ _ _ _ | _ _ _ _ _ _ _ _ |
+        // 7 6 5 4 3 2 1 0   F E D C B A 9 8 |
+        // ~~~~~                   ~~~~~~~~~
+        // 1 1 1 0 0 0 0 0 | 0 0 0 1 1 1 1 1   <- Bit Mask
+        // Lower Bound @ Block Index = 0, Offset = 5: Mask = ~((1 << 5) - 1) = 0b11100000; i.e. Clear low 5 bits.
+        // Upper Bound @ Block Index = 1, Offset = 4: Mask = (1 << (4 + 1) - 1) = 0b00011111; i.e. Set low 4 + 1 bits.
+        StorageUnit fMask = BitMask<StorageUnit>::createWithLowBitsClear(foffset); //~((static_cast<StorageUnit>(1) << foffset) - 1);
+
+        StorageUnit lMask = BitMask<StorageUnit>::createWithLowBitsSet(loffset + 1); //(static_cast<StorageUnit>(1) << (loffset + 1)) - 1;
+
+        BitOptions<StorageUnit> fOptions = this->getBlocks()[fblock].bitwiseAnd(fMask);
+
+        BitOptions<StorageUnit> lOptions = this->getBlocks()[lblock].bitwiseAnd(lMask);
+
+        // Finally treat the first and the last block specially when searching for the LSB
+        if (!fOptions.isEmpty())
+        {
+            // The LSB is in the first block
+            return fblock * NumBitsPerOptionsBlock + fOptions.findLeastSignificantBitIndex();
+        }
+
+        for (size_t index = fblock + 1; index < lblock; index += 1)
+        {
+            // Guard: Skip empty middle blocks
+            if (this->getBlocks()[index].isEmpty())
+            {
+                continue;
+            }
+
+            // The LSB is in the current block
+            return index * NumBitsPerOptionsBlock + this->getBlocks()[index].findLeastSignificantBitIndex();
+        }
+
+        if (!lOptions.isEmpty())
+        {
+            // The LSB is in the last block
+            return lblock * NumBitsPerOptionsBlock + lOptions.findLeastSignificantBitIndex();
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Find the position of the most significant bit
+    ///
+    /// @return Index of the most significant bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    ssize_t findMostSignificantBitIndex() const
+    {
+        for (size_t index = this->getNumBlocks(); index > 0; index -= 1)
+        {
+            // Guard: Skip the current block if it is empty
+            if (this->getBlocks()[index - 1].isEmpty())
+            {
+                continue;
+            }
+
+            // The current block is not empty
+            // Retrieve the index of the MSB in this block
+            uint32_t offset = this->getBlocks()[index - 1].findMostSignificantBitIndex();
+
+            return (index - 1) * NumBitsPerOptionsBlock + offset;
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Find the position of the most significant bit in the given range
+    ///
+    /// @param range Specify the range when searching for the most significant bit
+    /// @return The absolute index of the most significant bit on success, `-1` if no such bit exists.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    ssize_t findMostSignificantBitIndexWithRange(ClosedRange<Bound> range) const
+    {
+        // Block Array:
+        // --- Block 0 --- | --- Block 1 --- | ... | --- Block N --- |
+        // _ _ _ _ _ _ _ _ | _ _ _ _ _ _ _ _ |
+        // 7 6 5 4 3 2 1 0   F E D C B A 9 8 |
+        // Supposed that the range is [5, 12],
+        // First find the first block and the last block in the range.
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->index2BlockOffset(range.lowerBound, fblock, foffset))
+        {
+            perr("The lower bound %lu of the given range [%lu, %lu] is not valid.", range.lowerBound, range.lowerBound, range.upperBound);
+
+            return -1;
+        }
+
+        if (!this->index2BlockOffset(range.upperBound, lblock, loffset))
+        {
+            perr("The upper bound %lu of the given range [%lu, %lu] is not valid.", range.upperBound, range.lowerBound, range.upperBound);
+
+            return -1;
+        }
+
+        // Guard: Check whether the first and the last block are the same
+        if (fblock == lblock)
+        {
+            StorageUnit mask = BitMask<StorageUnit>::createWithRangeOfBitsSet({foffset, loffset});
+
+            BitOptions<StorageUnit> options = this->getBlocks()[fblock].bitwiseAnd(mask);
+
+            if (options.isEmpty())
+            {
+                return -1;
+            }
+            else
+            {
+                return fblock * NumBitsPerOptionsBlock + options.findMostSignificantBitIndex();
+            }
+        }
+
+        // Then make a copy of these two blocks and clear out-of-bounds bits
+        // --- Block 0 --- | --- Block 1 --- | ... | --- Block N --- |
+        // _ _ _ _ _ _ _ _ | _ _ _ _ _ _ _ _ |
+        // 7 6 5 4 3 2 1 0   F E D C B A 9 8 |
+        // ~~~~~                   ~~~~~~~~~
+        // 1 1 1 0 0 0 0 0 | 0 0 0 1 1 1 1 1   <- Bit Mask
+        // Lower Bound @ Block Index = 0, Offset = 5: Mask = ~((1 << 5) - 1) = 0b11100000; i.e. Clear low 5 bits.
+        // Upper Bound @ Block Index = 1, Offset = 4: Mask = (1 << (4 + 1)) - 1 = 0b00011111; i.e. Set low 4 + 1 bits.
+        StorageUnit fMask = BitMask<StorageUnit>::createWithLowBitsClear(foffset);
+
+        StorageUnit lMask = BitMask<StorageUnit>::createWithLowBitsSet(loffset + 1);
+
+        BitOptions<StorageUnit> fOptions = this->getBlocks()[fblock].bitwiseAnd(fMask);
+
+        BitOptions<StorageUnit> lOptions = this->getBlocks()[lblock].bitwiseAnd(lMask);
+
+        // Finally treat the first and the last block specially when searching for the MSB
+        if (!lOptions.isEmpty())
+        {
+            // The LSB is in the last block
+            return lblock * NumBitsPerOptionsBlock + lOptions.findMostSignificantBitIndex();
+        }
+
+        for (size_t index = lblock - 1; index > fblock; index -= 1)
+        {
+            // Guard: Skip empty middle blocks
+            if (this->getBlocks()[index].isEmpty())
+            {
+                continue;
+            }
+
+            // The LSB is in the current block
+            return index * NumBitsPerOptionsBlock + this->getBlocks()[index].findMostSignificantBitIndex();
+        }
+
+        if (!fOptions.isEmpty())
+        {
+            // The LSB is in the first block
+            return fblock * NumBitsPerOptionsBlock + fOptions.findMostSignificantBitIndex();
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Find the position of the first zero bit
+    ///
+    /// @return Index of the first zero bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    ssize_t findFirstZeroBitIndex() const
+    {
+        // Guard: The vector has no bits
+        if (this->getNumBits() == 0)
+        {
+            return -1;
+        }
+
+        return this->findFirstBitIndex<true>(0, 0, this->getNumBlocks() - 1, (this->getNumBits() - 1) % NumBitsPerOptionsBlock);
+    }
+
+    ///
+    /// Find the position of the first zero bit in the given range
+    ///
+    /// @param range Specify the range when searching for the first zero bit
+    /// @return The absolute index of the first zero bit on success, `-1` if no such bit exists.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    ssize_t findFirstZeroBitIndexWithRange(ClosedRange<Bound> range) const
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return -1;
+        }
+
+        return this->findFirstBitIndex<true>(fblock, foffset, lblock, loffset);
+    }
+
+    ///
+    /// Find the position of the first set bit at or after the given index
+    ///
+    /// @param from Index of the bit where the search starts
+    /// @return The absolute index of the next set bit on success, `-1` if no such bit exists.
+    /// @note The bit at `from` is included in the search.
+    ///
+    [[nodiscard]]
+    ssize_t findNextSetBit(size_t from) const
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (!this->index2BlockOffset(from, block, offset))
+        {
+            return -1;
+        }
+
+        return this->findFirstBitIndex<false>(block, offset, this->getNumBlocks() - 1, (this->getNumBits() - 1) % NumBitsPerOptionsBlock);
+    }
+
+    ///
+    /// Find the position of the first zero bit at or after the given index
+    ///
+    /// @param from Index of the bit where the search starts
+    /// @return The absolute index of the next zero bit on success, `-1` if no such bit exists.
+    /// @note The bit at `from` is included in the search.
+    ///
+    [[nodiscard]]
+    ssize_t findNextZeroBit(size_t from) const
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (!this->index2BlockOffset(from, block, offset))
+        {
+            return -1;
+        }
+
+        return this->findFirstBitIndex<true>(block, offset, this->getNumBlocks() - 1, (this->getNumBits() - 1) % NumBitsPerOptionsBlock);
+    }
+
+    // MARK: Manipulate a range of bits in the vector
+
+    ///
+    /// Set all bits in the given range
+    ///
+    /// @param range Specify the range of bits to set
+    /// @warning This function has no effect if the given range is invalid.
+    ///
+    template <typename Bound = size_t>
+    constexpr void setBits(ClosedRange<Bound> range)
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (this->range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            this->fillBits<true>(fblock, foffset, lblock, loffset);
+        }
+    }
+
+    ///
+    /// Clear all bits in the given range
+    ///
+    /// @param range Specify the range of bits to clear
+    /// @warning This function has no effect if the given range is invalid.
+    ///
+    template <typename Bound = size_t>
+    constexpr void clearBits(ClosedRange<Bound> range)
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (this->range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            this->fillBits<false>(fblock, foffset, lblock, loffset);
+        }
+    }
+
+    ///
+    /// Check whether all bits in the given range are set
+    ///
+    /// @param range Specify the range of bits to check
+    /// @return `true` if all bits in the given range are set, `false` otherwise or if the given range is invalid.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    bool allSet(ClosedRange<Bound> range) const
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return false;
+        }
+
+        // All bits are set if there is no zero bit
+        return this->findFirstBitIndex<true>(fblock, foffset, lblock, loffset) < 0;
+    }
+
+    ///
+    /// Check whether no bit in the given range is set
+    ///
+    /// @param range Specify the range of bits to check
+    /// @return `true` if all bits in the given range are clear, `false` otherwise or if the given range is invalid.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    bool noneSet(ClosedRange<Bound> range) const
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return false;
+        }
+
+        return this->findFirstBitIndex<false>(fblock, foffset, lblock, loffset) < 0;
+    }
+
+    ///
+    /// Set a run of bits starting at the given index
+    ///
+    /// @param start Index of the first bit
+    /// @param count The number of bits to set
+    /// @warning This function has no effect if the given run is empty or exceeds the end of the vector.
+    ///
+    constexpr void setRange(size_t start, size_t count)
+    {
+        // Guard: Ensure that the run is valid
+        if (count == 0 || start >= this->getNumBits() || count > this->getNumBits() - start)
+        {
+            return;
+        }
+
+        this->setBits(ClosedRange<size_t>::createWithLength(start, count));
+    }
+
+    ///
+    /// Clear a run of bits starting at the given index
+    ///
+    /// @param start Index of the first bit
+    /// @param count The number of bits to clear
+    /// @warning This function has no effect if the given run is empty or exceeds the end of the vector.
+    ///
+    constexpr void clearRange(size_t start, size_t count)
+    {
+        // Guard: Ensure that the run is valid
+        if (count == 0 || start >= this->getNumBits() || count > this->getNumBits() - start)
+        {
+            return;
+        }
+
+        this->clearBits(ClosedRange<size_t>::createWithLength(start, count));
+    }
+
+    ///
+    /// Find the first run of consecutive zero bits
+    ///
+    /// @param count The number of consecutive zero bits
+    /// @param alignment Specify the alignment of the index of the first bit in the run, `1` if no alignment is required
+    /// @return The index of the first bit in the run on success, `-1` if no such run exists.
+    /// @note This function jumps between zero bits and set bits a whole block at a time,
+    ///       so its cost depends on the number of candidate runs that are interrupted rather than the number of bits.
+    ///
+    [[nodiscard]]
+    ssize_t findContiguousZeroRun(size_t count, size_t alignment = 1) const
+    {
+        // Guard: Ensure that the arguments are valid
+        if (count == 0 || count > this->getNumBits() || alignment == 0)
+        {
+            perr("The given run length %lu or alignment %lu is not valid.", count, alignment);
+
+            return -1;
+        }
+
+        size_t from = 0;
+
+        while (true)
+        {
+            // Find the next zero bit as a candidate
+            ssize_t zero = this->findNextZeroBit(from);
+
+            if (zero < 0)
+            {
+                return -1;
+            }
+
+            // Round the candidate up to the alignment
+            size_t start = (static_cast<size_t>(zero) + alignment - 1) / alignment * alignment;
+
+            // Guard: The run cannot fit in the rest of the vector
+            if (start >= this->getNumBits() || count > this->getNumBits() - start)
+            {
+                return -1;
+            }
+
+            // Check whether the candidate run contains any set bit
+            // Search backwards, so that the next candidate can skip every set bit in the candidate run
+            ssize_t set = this->findMostSignificantBitIndexWithRange(ClosedRange<size_t>::createWithLength(start, count));
+
+            if (set < 0)
+            {
+                return static_cast<ssize_t>(start);
+            }
+
+            // The next run must start after the last set bit
+            from = set + 1;
+
+            // Guard: Reached the end of the vector
+            if (from >= this->getNumBits())
+            {
+                return -1;
+            }
+        }
+    }
+
+    // MARK: Count bits in the vector
+
+    ///
+    /// Count the number of set bits in the vector
+    ///
+    /// @return The number of set bits.
+    ///
+    [[nodiscard]]
+    size_t count() const
+    {
+        size_t count = 0;
+
+        for (size_t index = 0; index < this->getNumBlocks(); index += 1)
+        {
+            count += this->getBlocks()[index].count();
+        }
+
+        return count;
+    }
+
+    ///
+    /// Count the number of set bits before the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The number of set bits in the range `[0, index)`.
+    /// @note The number of all set bits is returned if the given index is not less than the total number of bits.
+    ///
+    [[nodiscard]]
+    size_t rank(size_t index) const
+    {
+        // Guard: All bits are before the given index
+        if (index >= this->getNumBits())
+        {
+            return this->count();
+        }
+
+        size_t block = index / NumBitsPerOptionsBlock;
+
+        size_t count = 0;
+
+        for (size_t current = 0; current < block; current += 1)
+        {
+            count += this->getBlocks()[current].count();
+        }
+
+        // Count the bits before the given index in its own block
+        return count + this->getBlocks()[block].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsSet(index % NumBitsPerOptionsBlock)).count();
+    }
+
+    ///
+    /// Find the position of the k-th set bit
+    ///
+    /// @param k Specify which set bit to find, starting from 0
+    /// @return The index of the k-th set bit on success, `-1` if the vector has no more than `k` bits set.
+    /// @note This function is the inverse of `rank()`, i.e. `rank(select(k)) == k`.
+    ///
+    [[nodiscard]]
+    ssize_t select(size_t k) const
+    {
+        for (size_t index = 0; index < this->getNumBlocks(); index += 1)
+        {
+            size_t count = this->getBlocks()[index].count();
+
+            // Guard: Skip the current block if it has no more than `k` bits set
+            if (k >= count)
+            {
+                k -= count;
+
+                continue;
+            }
+
+            return index * NumBitsPerOptionsBlock + this->getBlocks()[index].findNthSetBitIndex(k);
+        }
+
+        // Not found
+        return -1;
+    }
+
+    // MARK: Combine bit vectors
+    // Both vectors must have the same number of bits,
+    // otherwise the operators have no effect and the predicates return `false`.
+
+    ///
+    /// Intersect this bit vector with the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that keeps only bits set in both vectors.
+    ///
+    Derived& operator&=(const Derived& other)
+    {
+        if (this->hasSameNumBits(other))
+        {
+            BitwiseKernels<KernelUnit>::template transform<BitwiseAndOperation>(this->storage(), other.storage(), this->getNumKernelUnits());
+        }
+
+        return this->derived();
+    }
+
+    ///
+    /// Union this bit vector with the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that has bits set in either vector.
+    ///
+    Derived& operator|=(const Derived& other)
+    {
+        if (this->hasSameNumBits(other))
+        {
+            BitwiseKernels<KernelUnit>::template transform<BitwiseOrOperation>(this->storage(), other.storage(), this->getNumKernelUnits());
+        }
+
+        return this->derived();
+    }
+
+    ///
+    /// Compute the symmetric difference between this bit vector and the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that has bits set in exactly one of the vectors.
+    ///
+    Derived& operator^=(const Derived& other)
+    {
+        if (this->hasSameNumBits(other))
+        {
+            BitwiseKernels<KernelUnit>::template transform<BitwiseXorOperation>(this->storage(), other.storage(), this->getNumKernelUnits());
+        }
+
+        return this->derived();
+    }
+
+    ///
+    /// Clear the bits in this bit vector that are set in the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that keeps only bits not set in the given vector.
+    /// @note This function is equivalent to `*this &= ~other` but does not create the complement.
+    ///
+    Derived& andNot(const Derived& other)
+    {
+        if (this->hasSameNumBits(other))
+        {
+            BitwiseKernels<KernelUnit>::template transform<BitwiseAndNotOperation>(this->storage(), other.storage(), this->getNumKernelUnits());
+        }
+
+        return this->derived();
+    }
+
+    ///
+    /// Check whether this bit vector and the given one have any bit set in common
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return `true` if at least one bit is set in both vectors, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool intersects(const Derived& other) const
+    {
+        return this->hasSameNumBits(other) && BitwiseKernels<KernelUnit>::template any<BitwiseAndOperation>(this->storage(), other.storage(), this->getNumKernelUnits());
+    }
+
+    ///
+    /// Check whether every bit set in this bit vector is also set in the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return `true` if this vector is a subset of the given vector, `false` otherwise.
+    /// @note An empty bit vector is a subset of any bit vector.
+    ///
+    [[nodiscard]]
+    bool isSubsetOf(const Derived& other) const
+    {
+        return this->hasSameNumBits(other) && !BitwiseKernels<KernelUnit>::template any<BitwiseAndNotOperation>(this->storage(), other.storage(), this->getNumKernelUnits());
+    }
+
+    // MARK: Iterate over set bits in the vector
+
+    ///
+    /// Get an iterator to the index of the least significant set bit
+    ///
+    /// @return An iterator that visits the index of each set bit in ascending order.
+    /// @note The iterator skips empty blocks, so the bit vector can be used in a range-based for loop efficiently.
+    ///
+    [[nodiscard]]
+    inline SetBitIterator begin() const
+    {
+        return SetBitIterator(this->getBlocks(), this->getNumBlocks(), 0);
+    }
+
+    ///
+    /// Get an iterator past the index of the most significant set bit
+    ///
+    /// @return An iterator that has visited all set bits.
+    ///
+    [[nodiscard]]
+    inline SetBitIterator end() const
+    {
+        return SetBitIterator(this->getBlocks(), this->getNumBlocks(), this->getNumBlocks());
+    }
+
+    ///
+    /// Call the given action on the index of each set bit in ascending order
+    ///
+    /// @param action A functor that takes the index of each set bit
+    ///
+    template <typename Action>
+    requires std::invocable<Action, size_t> && std::same_as<std::invoke_result_t<Action, size_t>, void>
+    void forEachSetBit(Action action) const
+    {
+        for (size_t index = 0; index < this->getNumBlocks(); index += 1)
+        {
+            size_t base = index * NumBitsPerOptionsBlock;
+
+            this->getBlocks()[index].forEachSetBit([&](uint32_t offset) -> void { action(base + offset); });
+        }
+    }
+};
+
+#endif /* BitVectorBase_hpp */
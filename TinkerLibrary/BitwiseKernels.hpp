@@ -0,0 +1,213 @@
+//
+//  BitwiseKernels.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitwiseKernels_hpp
+#define BitwiseKernels_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include "WideUnsignedInteger.hpp"
+
+//
+// MARK: - Instruction Set Selection
+//
+// Kernels are selected at compile time by the target instruction set.
+// AVX2 kernels process 32 bytes per iteration, while SSE2 kernels process 16 bytes per iteration.
+// The kernel build usually disables SIMD registers (e.g. `-mno-sse`), in which case the scalar kernels are used.
+//
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define BITWISE_KERNELS_AVX2 1
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+    #define BITWISE_KERNELS_SSE2 1
+#endif
+
+//
+// MARK: - Operations
+//
+// Each operation provides an overload of `apply()` for each supported register type.
+// The scalar overload also accepts wide integers, so that `BitMatrix` combines blocks of any storage unit with the same operations.
+//
+
+/// Bitwise AND: lhs & rhs
+struct BitwiseAndOperation
+{
+    template <typename T>
+    requires ExtendedUnsignedIntegral<T>
+    static inline T apply(T lhs, T rhs) { return lhs & rhs; }
+
+#if defined(BITWISE_KERNELS_AVX2)
+    static inline __m256i apply(__m256i lhs, __m256i rhs) { return _mm256_and_si256(lhs, rhs); }
+#elif defined(BITWISE_KERNELS_SSE2)
+    static inline __m128i apply(__m128i lhs, __m128i rhs) { return _mm_and_si128(lhs, rhs); }
+#endif
+};
+
+/// Bitwise OR: lhs | rhs
+struct BitwiseOrOperation
+{
+    template <typename T>
+    requires ExtendedUnsignedIntegral<T>
+    static inline T apply(T lhs, T rhs) { return lhs | rhs; }
+
+#if defined(BITWISE_KERNELS_AVX2)
+    static inline __m256i apply(__m256i lhs, __m256i rhs) { return _mm256_or_si256(lhs, rhs); }
+#elif defined(BITWISE_KERNELS_SSE2)
+    static inline __m128i apply(__m128i lhs, __m128i rhs) { return _mm_or_si128(lhs, rhs); }
+#endif
+};
+
+/// Bitwise XOR: lhs ^ rhs
+struct BitwiseXorOperation
+{
+    template <typename T>
+    requires ExtendedUnsignedIntegral<T>
+    static inline T apply(T lhs, T rhs) { return lhs ^ rhs; }
+
+#if defined(BITWISE_KERNELS_AVX2)
+    static inline __m256i apply(__m256i lhs, __m256i rhs) { return _mm256_xor_si256(lhs, rhs); }
+#elif defined(BITWISE_KERNELS_SSE2)
+    static inline __m128i apply(__m128i lhs, __m128i rhs) { return _mm_xor_si128(lhs, rhs); }
+#endif
+};
+
+/// Bitwise AND NOT: lhs & ~rhs
+struct BitwiseAndNotOperation
+{
+    template <typename T>
+    requires ExtendedUnsignedIntegral<T>
+    static inline T apply(T lhs, T rhs) { return lhs & static_cast<T>(~rhs); }
+
+    // Note that the intrinsic computes `~first & second`
+#if defined(BITWISE_KERNELS_AVX2)
+    static inline __m256i apply(__m256i lhs, __m256i rhs) { return _mm256_andnot_si256(rhs, lhs); }
+#elif defined(BITWISE_KERNELS_SSE2)
+    static inline __m128i apply(__m128i lhs, __m128i rhs) { return _mm_andnot_si128(rhs, lhs); }
+#endif
+};
+
+//
+// MARK: - Kernels
+//
+
+/// Kernels that apply a bitwise operation to two arrays of integers
+template <typename T>
+requires std::unsigned_integral<T>
+struct BitwiseKernels
+{
+    ///
+    /// Apply the given operation to each pair of elements and store the result in the first array
+    ///
+    /// @tparam Operation Specify the bitwise operation
+    /// @param lhs The array of left operands that stores the result on return
+    /// @param rhs The array of right operands
+    /// @param count The number of elements in each array
+    /// @note `lhs[i] = Operation::apply(lhs[i], rhs[i])` for each `i` in `[0, count)`.
+    ///
+    template <typename Operation>
+    static void transform(T* lhs, const T* rhs, size_t count)
+    {
+        size_t index = 0;
+
+#if defined(BITWISE_KERNELS_AVX2)
+        static constexpr size_t kNumElementsPerRegister = sizeof(__m256i) / sizeof(T);
+
+        for (; index + kNumElementsPerRegister <= count; index += kNumElementsPerRegister)
+        {
+            __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + index));
+
+            __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + index));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lhs + index), Operation::apply(left, right));
+        }
+#elif defined(BITWISE_KERNELS_SSE2)
+        static constexpr size_t kNumElementsPerRegister = sizeof(__m128i) / sizeof(T);
+
+        for (; index + kNumElementsPerRegister <= count; index += kNumElementsPerRegister)
+        {
+            __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+
+            __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lhs + index), Operation::apply(left, right));
+        }
+#endif
+
+        // Scalar fallback and the remaining elements
+        for (; index < count; index += 1)
+        {
+            lhs[index] = Operation::apply(lhs[index], rhs[index]);
+        }
+    }
+
+    ///
+    /// Check whether the given operation produces a non-zero result for any pair of elements
+    ///
+    /// @tparam Operation Specify the bitwise operation
+    /// @param lhs The array of left operands
+    /// @param rhs The array of right operands
+    /// @param count The number of elements in each array
+    /// @return `true` if `Operation::apply(lhs[i], rhs[i]) != 0` for any `i` in `[0, count)`, `false` otherwise.
+    /// @note This function returns as soon as a non-zero result is found.
+    ///
+    template <typename Operation>
+    static bool any(const T* lhs, const T* rhs, size_t count)
+    {
+        size_t index = 0;
+
+#if defined(BITWISE_KERNELS_AVX2)
+        static constexpr size_t kNumElementsPerRegister = sizeof(__m256i) / sizeof(T);
+
+        for (; index + kNumElementsPerRegister <= count; index += kNumElementsPerRegister)
+        {
+            __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + index));
+
+            __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + index));
+
+            __m256i result = Operation::apply(left, right);
+
+            if (!_mm256_testz_si256(result, result))
+            {
+                return true;
+            }
+        }
+#elif defined(BITWISE_KERNELS_SSE2)
+        static constexpr size_t kNumElementsPerRegister = sizeof(__m128i) / sizeof(T);
+
+        for (; index + kNumElementsPerRegister <= count; index += kNumElementsPerRegister)
+        {
+            __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + index));
+
+            __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + index));
+
+            // SSE2 has no `ptest`, so compare each byte against zero instead
+            __m128i zeros = _mm_cmpeq_epi8(Operation::apply(left, right), _mm_setzero_si128());
+
+            if (_mm_movemask_epi8(zeros) != 0xFFFF)
+            {
+                return true;
+            }
+        }
+#endif
+
+        // Scalar fallback and the remaining elements
+        for (; index < count; index += 1)
+        {
+            if (Operation::apply(lhs[index], rhs[index]) != 0)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+#endif /* BitwiseKernels_hpp */
@@ -0,0 +1,703 @@
+//
+//  CPUDispatch.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef CPUDispatch_hpp
+#define CPUDispatch_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include "SignificantBit.hpp"
+
+//
+// MARK: - Instruction Set Selection
+//
+// Unlike `SignificantBitKernels` and `BitwiseKernels`, which are selected at compile time by the target instruction set,
+// the kernels below are selected at runtime by the features that the processor reports via `cpuid`,
+// so that a binary built for the baseline x86-64 still uses AVX2 or AVX-512 on the processors that support them.
+// Each variant is compiled for its own instruction set with the `target` attribute, which GCC and Clang support on x86-64.
+// Other targets and compilers only have the portable variants.
+// Define `CPU_DISPATCH_PORTABLE` to always use the portable variants.
+//
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(CPU_DISPATCH_PORTABLE)
+    #include <cpuid.h>
+    #include <immintrin.h>
+    #define CPU_DISPATCH_X86 1
+    #define CPU_DISPATCH_TARGET(features) __attribute__((target(features)))
+#endif
+
+//
+// MARK: - Processor Features
+//
+
+/// Features of the processor that the dispatcher cares about
+struct CPUFeatures
+{
+    /// `popcnt`
+    bool popcnt = false;
+
+    /// `lzcnt`, also known as ABM on AMD processors
+    bool lzcnt = false;
+
+    /// AVX2 instructions, supported by both the processor and the operating system
+    bool avx2 = false;
+
+    /// AVX-512 Foundation instructions, supported by both the processor and the operating system
+    bool avx512f = false;
+
+    /// AVX-512 Conflict Detection instructions, including `vplzcnt`
+    bool avx512cd = false;
+
+    /// AVX-512 `vpopcntd` and `vpopcntq` instructions
+    bool avx512vpopcntdq = false;
+
+    /// Enhanced `rep movsb` and `rep stosb`, which copy and fill whole cache lines internally
+    bool erms = false;
+
+    ///
+    /// Detect the features of the current processor
+    ///
+    /// @return The features of the current processor, all of which are `false` on targets other than x86-64.
+    ///
+    static CPUFeatures detect()
+    {
+        CPUFeatures features;
+
+#if defined(CPU_DISPATCH_X86)
+        uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+        // Guard: The processor does not support the leaf of basic features
+        if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+        {
+            return features;
+        }
+
+        features.popcnt = (ecx & (1U << 23)) != 0;
+
+        // The operating system must save the upper halves of YMM registers (XCR0 bits 1 and 2) to enable AVX,
+        // and the opmask and ZMM registers (XCR0 bits 5 to 7) to enable AVX-512.
+        uint64_t xcr0 = 0;
+
+        if ((ecx & (1U << 27)) != 0)
+        {
+            uint32_t low = 0, high = 0;
+
+            asm volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+
+            xcr0 = (static_cast<uint64_t>(high) << 32) | low;
+        }
+
+        bool ymm = (ecx & (1U << 28)) != 0 && (xcr0 & 0x06) == 0x06;
+
+        bool zmm = ymm && (xcr0 & 0xE0) == 0xE0;
+
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0)
+        {
+            features.avx2 = ymm && (ebx & (1U << 5)) != 0;
+
+            features.erms = (ebx & (1U << 9)) != 0;
+
+            features.avx512f = zmm && (ebx & (1U << 16)) != 0;
+
+            features.avx512cd = zmm && (ebx & (1U << 28)) != 0;
+
+            features.avx512vpopcntdq = zmm && (ecx & (1U << 14)) != 0;
+        }
+
+        if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) != 0)
+        {
+            features.lzcnt = (ecx & (1U << 5)) != 0;
+        }
+#endif
+
+        return features;
+    }
+};
+
+//
+// MARK: - Variants
+//
+// Each variant provides a subset of the following kernels, which produce the same results as the portable ones:
+//
+// - `findLeastSignificantBitIndices` and `findMostSignificantBitIndices` have the same semantics as the ones in `SignificantBitKernels`.
+// - `countSetBits` returns the total number of set bits in an array of 64-bit integers.
+// - `copyMemory` and `fillMemory` have the same semantics as `memcpy` and `memset`.
+//
+
+/// Portable kernels that are available on all processors
+struct PortableDispatchKernels
+{
+    static void findLeastSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        for (size_t index = 0; index < count; index += 1)
+        {
+            indices[index] = LSBFinder<uint64_t>()(values[index]);
+        }
+    }
+
+    static void findMostSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        for (size_t index = 0; index < count; index += 1)
+        {
+            indices[index] = MSBFinder<uint64_t>()(values[index]);
+        }
+    }
+
+    static size_t countSetBits(const uint64_t* values, size_t count)
+    {
+        size_t total = 0;
+
+        for (size_t index = 0; index < count; index += 1)
+        {
+            total += PopulationCounter<uint64_t>()(values[index]);
+        }
+
+        return total;
+    }
+
+    static void* copyMemory(void* destination, const void* source, size_t length)
+    {
+        auto target = static_cast<uint8_t*>(destination);
+
+        auto origin = static_cast<const uint8_t*>(source);
+
+        // Copy 8 bytes at a time, where `__builtin_memcpy` with a constant size compiles to a single unaligned load or store
+        for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), target += sizeof(uint64_t), origin += sizeof(uint64_t))
+        {
+            uint64_t word;
+
+            __builtin_memcpy(&word, origin, sizeof(uint64_t));
+
+            __builtin_memcpy(target, &word, sizeof(uint64_t));
+        }
+
+        for (; length > 0; length -= 1)
+        {
+            *target++ = *origin++;
+        }
+
+        return destination;
+    }
+
+    static void* fillMemory(void* destination, int value, size_t length)
+    {
+        auto target = static_cast<uint8_t*>(destination);
+
+        uint64_t word = static_cast<uint8_t>(value) * 0x0101010101010101ULL;
+
+        for (; length >= sizeof(uint64_t); length -= sizeof(uint64_t), target += sizeof(uint64_t))
+        {
+            __builtin_memcpy(target, &word, sizeof(uint64_t));
+        }
+
+        for (; length > 0; length -= 1)
+        {
+            *target++ = static_cast<uint8_t>(value);
+        }
+
+        return destination;
+    }
+};
+
+#if defined(CPU_DISPATCH_X86)
+/// Kernels that use `popcnt` and `lzcnt`
+/// @note The portable LSB kernel already compiles to `bsf`, which is as fast as `tzcnt`, so there is no LSB kernel here.
+struct BitManipulationDispatchKernels
+{
+    CPU_DISPATCH_TARGET("lzcnt")
+    static void findMostSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        // Setting the lowest bit yields 0 for zero without a branch
+        for (size_t index = 0; index < count; index += 1)
+        {
+            indices[index] = static_cast<uint32_t>(63 - _lzcnt_u64(values[index] | 1));
+        }
+    }
+
+    CPU_DISPATCH_TARGET("popcnt")
+    static size_t countSetBits(const uint64_t* values, size_t count)
+    {
+        size_t total = 0;
+
+        for (size_t index = 0; index < count; index += 1)
+        {
+            total += static_cast<size_t>(_mm_popcnt_u64(values[index]));
+        }
+
+        return total;
+    }
+};
+
+/// Kernels that use `rep movsb` and `rep stosb`
+struct ERMSDispatchKernels
+{
+    static void* copyMemory(void* destination, const void* source, size_t length)
+    {
+        void* target = destination;
+
+        asm volatile("rep movsb" : "+D"(target), "+S"(source), "+c"(length) : : "memory");
+
+        return destination;
+    }
+
+    static void* fillMemory(void* destination, int value, size_t length)
+    {
+        void* target = destination;
+
+        asm volatile("rep stosb" : "+D"(target), "+c"(length) : "a"(value) : "memory");
+
+        return destination;
+    }
+};
+
+/// Kernels that use AVX2 instructions
+struct AVX2DispatchKernels
+{
+    CPU_DISPATCH_TARGET("avx2")
+    static size_t countSetBits(const uint64_t* values, size_t count)
+    {
+        // Look up the number of set bits in each nibble, and then add up the bytes of each 64-bit lane with `vpsadbw`
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+        const __m256i nibbles = _mm256_set1_epi8(0x0F);
+
+        __m256i totals = _mm256_setzero_si256();
+
+        size_t index = 0;
+
+        for (; index + 4 <= count; index += 4)
+        {
+            __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+
+            __m256i low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(input, nibbles));
+
+            __m256i high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbles));
+
+            totals = _mm256_add_epi64(totals, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+        }
+
+        size_t total = static_cast<size_t>(_mm256_extract_epi64(totals, 0) + _mm256_extract_epi64(totals, 1) +
+                                           _mm256_extract_epi64(totals, 2) + _mm256_extract_epi64(totals, 3));
+
+        return total + PortableDispatchKernels::countSetBits(values + index, count - index);
+    }
+
+    CPU_DISPATCH_TARGET("avx2")
+    static void* copyMemory(void* destination, const void* source, size_t length)
+    {
+        auto target = static_cast<uint8_t*>(destination);
+
+        auto origin = static_cast<const uint8_t*>(source);
+
+        // Guard: Copy up to 32 bytes with two overlapping loads and stores of the largest size that fits
+        if (length <= 32)
+        {
+            return AVX2DispatchKernels::copySmallMemory(target, origin, length);
+        }
+
+        // Load the last 32 bytes first, and store them last to cover the remainder of the loop
+        __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origin + length - 32));
+
+        for (size_t offset = 0; offset + 32 < length; offset += 32)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + offset), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(origin + offset)));
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + length - 32), tail);
+
+        return destination;
+    }
+
+    CPU_DISPATCH_TARGET("avx2")
+    static void* fillMemory(void* destination, int value, size_t length)
+    {
+        auto target = static_cast<uint8_t*>(destination);
+
+        // Guard: Fill up to 32 bytes with two overlapping stores of the largest size that fits
+        if (length < 32)
+        {
+            uint64_t word = static_cast<uint8_t>(value) * 0x0101010101010101ULL;
+
+            if (length >= 16)
+            {
+                __m128i bytes = _mm_set1_epi64x(static_cast<int64_t>(word));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(target), bytes);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(target + length - 16), bytes);
+            }
+            else if (length >= 8)
+            {
+                __builtin_memcpy(target, &word, 8);
+
+                __builtin_memcpy(target + length - 8, &word, 8);
+            }
+            else
+            {
+                PortableDispatchKernels::fillMemory(target, value, length);
+            }
+
+            return destination;
+        }
+
+        __m256i bytes = _mm256_set1_epi8(static_cast<char>(value));
+
+        for (size_t offset = 0; offset + 32 < length; offset += 32)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + offset), bytes);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + length - 32), bytes);
+
+        return destination;
+    }
+
+private:
+    ///
+    /// Copy up to 32 bytes
+    ///
+    /// @param target The destination
+    /// @param origin The source
+    /// @param length The number of bytes, which must not exceed 32
+    /// @return The destination.
+    ///
+    CPU_DISPATCH_TARGET("avx2")
+    static void* copySmallMemory(uint8_t* target, const uint8_t* origin, size_t length)
+    {
+        if (length >= 16)
+        {
+            __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origin));
+
+            __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(origin + length - 16));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(target), head);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(target + length - 16), tail);
+        }
+        else if (length >= 8)
+        {
+            uint64_t head, tail;
+
+            __builtin_memcpy(&head, origin, 8);
+
+            __builtin_memcpy(&tail, origin + length - 8, 8);
+
+            __builtin_memcpy(target, &head, 8);
+
+            __builtin_memcpy(target + length - 8, &tail, 8);
+        }
+        else
+        {
+            PortableDispatchKernels::copyMemory(target, origin, length);
+        }
+
+        return target;
+    }
+};
+
+/// Kernels that use AVX2 instructions for short lengths and `rep movsb` and `rep stosb` for long lengths
+/// @note The microcode of `rep movsb` has a startup cost of a few dozen cycles, but then moves whole cache lines at a time.
+struct AVX2ERMSDispatchKernels
+{
+    /// The length from which `rep movsb` and `rep stosb` are faster than AVX2 loops, which is also the default of glibc
+    static constexpr size_t kThreshold = 2048;
+
+    static void* copyMemory(void* destination, const void* source, size_t length)
+    {
+        if (length < kThreshold)
+        {
+            return AVX2DispatchKernels::copyMemory(destination, source, length);
+        }
+
+        return ERMSDispatchKernels::copyMemory(destination, source, length);
+    }
+
+    static void* fillMemory(void* destination, int value, size_t length)
+    {
+        if (length < kThreshold)
+        {
+            return AVX2DispatchKernels::fillMemory(destination, value, length);
+        }
+
+        return ERMSDispatchKernels::fillMemory(destination, value, length);
+    }
+};
+
+/// Kernels that use AVX-512 instructions
+/// @note The remaining integers are loaded and stored with masks, which do not touch the memory beyond the arrays.
+struct AVX512DispatchKernels
+{
+    CPU_DISPATCH_TARGET("avx512f,avx512cd")
+    static void findLeastSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        for (size_t index = 0; index < count; index += 8)
+        {
+            __mmask8 mask = AVX512DispatchKernels::createMask(count - index);
+
+            __m512i input = _mm512_maskz_loadu_epi64(mask, values + index);
+
+            // Isolate the lowest set bit, whose index is 63 - lzcnt, and zero the index of zero rather than -1
+            __m512i lowest = _mm512_and_si512(input, _mm512_sub_epi64(_mm512_setzero_si512(), input));
+
+            __m512i output = _mm512_maskz_sub_epi64(_mm512_test_epi64_mask(input, input), _mm512_set1_epi64(63), _mm512_lzcnt_epi64(lowest));
+
+            // Narrow 64-bit indices to 32 bits
+            _mm512_mask_cvtepi64_storeu_epi32(indices + index, mask, output);
+        }
+    }
+
+    CPU_DISPATCH_TARGET("avx512f,avx512cd")
+    static void findMostSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        for (size_t index = 0; index < count; index += 8)
+        {
+            __mmask8 mask = AVX512DispatchKernels::createMask(count - index);
+
+            __m512i input = _mm512_maskz_loadu_epi64(mask, values + index);
+
+            // Setting the lowest bit yields 0 for zero
+            __m512i output = _mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(_mm512_or_si512(input, _mm512_set1_epi64(1))));
+
+            _mm512_mask_cvtepi64_storeu_epi32(indices + index, mask, output);
+        }
+    }
+
+    CPU_DISPATCH_TARGET("avx512f,avx512vpopcntdq")
+    static size_t countSetBits(const uint64_t* values, size_t count)
+    {
+        __m512i totals = _mm512_setzero_si512();
+
+        for (size_t index = 0; index < count; index += 8)
+        {
+            __m512i input = _mm512_maskz_loadu_epi64(AVX512DispatchKernels::createMask(count - index), values + index);
+
+            totals = _mm512_add_epi64(totals, _mm512_popcnt_epi64(input));
+        }
+
+        uint64_t lanes[8];
+
+        _mm512_storeu_si512(lanes, totals);
+
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7];
+    }
+
+private:
+    ///
+    /// Create the mask of the next 8 integers
+    ///
+    /// @param remaining The number of remaining integers, which must be positive
+    /// @return The mask that has the low `min(remaining, 8)` bits set.
+    ///
+    static inline __mmask8 createMask(size_t remaining)
+    {
+        return remaining >= 8 ? 0xFF : static_cast<__mmask8>((1U << remaining) - 1);
+    }
+};
+#endif
+
+//
+// MARK: - Dispatcher
+//
+
+/// A table of the kernels selected for a processor
+struct CPUDispatchTable
+{
+    /// A kernel along with the name of its variant
+    template <typename Function>
+    struct Entry
+    {
+        /// The kernel
+        Function function;
+
+        /// The name of the variant, e.g. "AVX2", which is meant to be logged
+        const char* variant;
+    };
+
+    Entry<void (*)(const uint64_t*, uint32_t*, size_t)> findLeastSignificantBitIndices = { &PortableDispatchKernels::findLeastSignificantBitIndices, "Portable" };
+
+    Entry<void (*)(const uint64_t*, uint32_t*, size_t)> findMostSignificantBitIndices = { &PortableDispatchKernels::findMostSignificantBitIndices, "Portable" };
+
+    Entry<size_t (*)(const uint64_t*, size_t)> countSetBits = { &PortableDispatchKernels::countSetBits, "Portable" };
+
+    Entry<void* (*)(void*, const void*, size_t)> copyMemory = { &PortableDispatchKernels::copyMemory, "Portable" };
+
+    Entry<void* (*)(void*, int, size_t)> fillMemory = { &PortableDispatchKernels::fillMemory, "Portable" };
+
+    ///
+    /// Select the best kernels for a processor with the given features
+    ///
+    /// @param features The features of the processor
+    /// @return The table of the selected kernels.
+    ///
+    static CPUDispatchTable createWithFeatures([[maybe_unused]] const CPUFeatures& features)
+    {
+        CPUDispatchTable table;
+
+#if defined(CPU_DISPATCH_X86)
+        if (features.avx512f && features.avx512cd)
+        {
+            table.findLeastSignificantBitIndices = { &AVX512DispatchKernels::findLeastSignificantBitIndices, "AVX-512" };
+
+            table.findMostSignificantBitIndices = { &AVX512DispatchKernels::findMostSignificantBitIndices, "AVX-512" };
+        }
+        else if (features.lzcnt)
+        {
+            table.findMostSignificantBitIndices = { &BitManipulationDispatchKernels::findMostSignificantBitIndices, "LZCNT" };
+        }
+
+        if (features.avx512f && features.avx512vpopcntdq)
+        {
+            table.countSetBits = { &AVX512DispatchKernels::countSetBits, "AVX-512" };
+        }
+        else if (features.avx2)
+        {
+            table.countSetBits = { &AVX2DispatchKernels::countSetBits, "AVX2" };
+        }
+        else if (features.popcnt)
+        {
+            table.countSetBits = { &BitManipulationDispatchKernels::countSetBits, "POPCNT" };
+        }
+
+        if (features.avx2 && features.erms)
+        {
+            table.copyMemory = { &AVX2ERMSDispatchKernels::copyMemory, "AVX2+ERMS" };
+
+            table.fillMemory = { &AVX2ERMSDispatchKernels::fillMemory, "AVX2+ERMS" };
+        }
+        else if (features.avx2)
+        {
+            table.copyMemory = { &AVX2DispatchKernels::copyMemory, "AVX2" };
+
+            table.fillMemory = { &AVX2DispatchKernels::fillMemory, "AVX2" };
+        }
+        else if (features.erms)
+        {
+            table.copyMemory = { &ERMSDispatchKernels::copyMemory, "ERMS" };
+
+            table.fillMemory = { &ERMSDispatchKernels::fillMemory, "ERMS" };
+        }
+#endif
+
+        return table;
+    }
+};
+
+///
+/// Dispatches kernels to the variants selected for the current processor
+///
+/// The table is resolved once at startup by a static initializer.
+/// Until then, e.g. in other static initializers, and in the kernel, which has no static initializers,
+/// the table refers to the portable variants, so that calls are always valid.
+/// The kernel should call `CPUDispatcher::resolve()` once it enables the SIMD registers.
+///
+/// Example:
+///
+/// ```
+/// pinfo("Population Count: %s.", CPUDispatcher::getTable().countSetBits.variant);
+///
+/// size_t count = CPUDispatcher::countSetBits(words, numWords);
+/// ```
+///
+struct CPUDispatcher
+{
+private:
+    /// The table of selected kernels, which is constant initialized to the portable variants
+    static inline CPUDispatchTable table;
+
+    /// Resolve the table at startup
+    static const bool resolvedAtStartup;
+
+public:
+    ///
+    /// Select the best kernels for the current processor
+    ///
+    /// @note This function is not thread safe, so it should be called before other threads use the kernels.
+    ///
+    static void resolve()
+    {
+        CPUDispatcher::table = CPUDispatchTable::createWithFeatures(CPUFeatures::detect());
+    }
+
+    ///
+    /// Get the table of selected kernels
+    ///
+    /// @return The table, whose entries tell which variant of each kernel is selected.
+    ///
+    static const CPUDispatchTable& getTable()
+    {
+        return CPUDispatcher::table;
+    }
+
+    ///
+    /// Find the LSB index of each integer in the given array
+    ///
+    /// @param values The array of integers
+    /// @param indices The array that stores the LSB indices on return
+    /// @param count The number of elements in each array
+    /// @note The LSB index of zero is 0, which is consistent with `LSBFinder`.
+    ///
+    static inline void findLeastSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        CPUDispatcher::table.findLeastSignificantBitIndices.function(values, indices, count);
+    }
+
+    ///
+    /// Find the MSB index of each integer in the given array
+    ///
+    /// @param values The array of integers
+    /// @param indices The array that stores the MSB indices on return
+    /// @param count The number of elements in each array
+    /// @note The MSB index of zero is 0, which is consistent with `MSBFinder`.
+    ///
+    static inline void findMostSignificantBitIndices(const uint64_t* values, uint32_t* indices, size_t count)
+    {
+        CPUDispatcher::table.findMostSignificantBitIndices.function(values, indices, count);
+    }
+
+    ///
+    /// Count the number of set bits in the given array
+    ///
+    /// @param values The array of integers
+    /// @param count The number of elements in the array
+    /// @return The total number of set bits.
+    ///
+    static inline size_t countSetBits(const uint64_t* values, size_t count)
+    {
+        return CPUDispatcher::table.countSetBits.function(values, count);
+    }
+
+    ///
+    /// Copy bytes from the source to the destination, which must not overlap
+    ///
+    /// @param destination The destination
+    /// @param source The source
+    /// @param length The number of bytes
+    /// @return The destination.
+    ///
+    static inline void* copyMemory(void* destination, const void* source, size_t length)
+    {
+        return CPUDispatcher::table.copyMemory.function(destination, source, length);
+    }
+
+    ///
+    /// Fill the destination with the given byte
+    ///
+    /// @param destination The destination
+    /// @param value The byte, which is converted to `uint8_t`
+    /// @param length The number of bytes
+    /// @return The destination.
+    ///
+    static inline void* fillMemory(void* destination, int value, size_t length)
+    {
+        return CPUDispatcher::table.fillMemory.function(destination, value, length);
+    }
+};
+
+inline const bool CPUDispatcher::resolvedAtStartup = (CPUDispatcher::resolve(), true);
+
+#endif /* CPUDispatch_hpp */
@@ -25,7 +25,7 @@ struct ClosedRange
     Bound upperBound;
 
     /// Create a closed range with the given bounds
-    ClosedRange(Bound lowerBound, Bound upperBound)
+    constexpr ClosedRange(Bound lowerBound, Bound upperBound)
     {
         passert(lowerBound <= upperBound, "The given bounds are invalid.");
 
@@ -41,14 +41,14 @@ struct ClosedRange
     /// @param length The number of elements in the range
     /// @return A closed range that starts at `start` and covers `length` elements.
     ///
-    static inline ClosedRange createWithLength(Bound start, Bound length)
+    static constexpr ClosedRange createWithLength(Bound start, Bound length)
     {
         return ClosedRange(start, start + length - 1);
     }
 
     /// Get the number of elements in this range
     [[nodiscard]]
-    inline Bound getLength() const
+    constexpr Bound getLength() const
     {
         return this->upperBound - this->lowerBound + 1;
     }
@@ -59,7 +59,7 @@ struct ClosedRange
     /// @return `true` if valid, `false` otherwise.
     ///
     [[nodiscard]]
-    inline bool isValid() const
+    constexpr bool isValid() const
     {
         return this->lowerBound <= this->upperBound;
     }
@@ -0,0 +1,1128 @@
+//
+//  CompressedBitVector.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef CompressedBitVector_hpp
+#define CompressedBitVector_hpp
+
+#include <algorithm>
+#include <cstdint>
+#include "StaticBitVector.hpp"
+#include "BitVectorAllocator.hpp"
+
+///
+/// A compressed bit vector manages a sparse set of bits in a 32-bit index space
+///
+/// The index space is divided into chunks of 65536 bits, and only chunks that contain at least one set bit are stored.
+/// Each chunk picks the most compact one of the following containers, in the same way as Roaring bitmaps:
+///
+/// - Array : A sorted array of the low 16 bits of set bits, used when the chunk has no more than 4096 bits set.
+/// - Bitmap: A plain `StaticBitVector<65536>` that takes 8 KiB, used when the chunk has more than 4096 bits set.
+/// - Runs  : A sorted array of runs of consecutive set bits, used by `optimize()` when it is the smallest container.
+///
+/// Memory Usage: (2^32 bits with 4096 bits set at random)
+/// StaticBitVector    : 512 MiB
+/// CompressedBitVector: About 4096 chunks x (24 bytes + 8 bytes), i.e. 128 KiB.
+///
+/// Looking up a bit binary searches the sorted chunks and then the container,
+/// so it takes O(log C + log 4096) time where C is the number of non-empty chunks.
+///
+/// @tparam Allocator Specify the type of the allocator that provides the storage of chunks and containers
+/// @note Functions that modify the vector might allocate memory and return `false` if the allocator is out of memory.
+///
+template <typename Allocator = HeapBitVectorAllocator>
+requires BitVectorAllocator<Allocator>
+class CompressedBitVector
+{
+private:
+    /// The type of the bitmap container
+    using Bitmap = StaticBitVector<65536, uint64_t>;
+
+    /// A run of consecutive set bits in a chunk
+    struct Run
+    {
+        /// The low 16 bits of the first set bit in the run
+        uint16_t first;
+
+        /// The low 16 bits of the last set bit in the run
+        uint16_t last;
+    };
+
+    /// The type of the container in a chunk
+    enum class ContainerType: uint8_t
+    {
+        Array,
+        Bitmap,
+        Runs
+    };
+
+    /// A chunk of 65536 bits that contains at least one set bit
+    struct Chunk
+    {
+        /// The high 16 bits of all bits in the chunk
+        uint16_t key;
+
+        /// The type of the container
+        ContainerType type;
+
+        /// The number of set bits in the chunk
+        uint32_t cardinality;
+
+        /// The number of elements in use in the container (Array: values; Runs: runs; Bitmap: unused)
+        uint32_t size;
+
+        /// The number of elements the container can hold (Array: values; Runs: runs; Bitmap: unused)
+        uint32_t capacity;
+
+        /// The storage of the container
+        void* storage;
+
+        /// Get the array container
+        [[nodiscard]]
+        inline uint16_t* values() const
+        {
+            return reinterpret_cast<uint16_t*>(this->storage);
+        }
+
+        /// Get the bitmap container
+        [[nodiscard]]
+        inline Bitmap* bitmap() const
+        {
+            return reinterpret_cast<Bitmap*>(this->storage);
+        }
+
+        /// Get the run container
+        [[nodiscard]]
+        inline Run* runs() const
+        {
+            return reinterpret_cast<Run*>(this->storage);
+        }
+    };
+
+    /// Compile time constant that stores the maximum number of values in an array container
+    /// An array container of this size takes the same amount of memory as a bitmap container
+    static constexpr uint32_t MaxArraySize = sizeof(Bitmap) / sizeof(uint16_t);
+
+    /// Compile time constant that stores the maximum number of runs in a run container
+    /// A run container of this size takes the same amount of memory as a bitmap container
+    static constexpr uint32_t MaxNumRuns = sizeof(Bitmap) / sizeof(Run);
+
+    /// Compile time constant that stores the minimum number of elements allocated for a container or for the chunks
+    static constexpr uint32_t MinCapacity = 4;
+
+    /// The sorted chunks that contain at least one set bit
+    Chunk* chunks;
+
+    /// The number of chunks in use
+    size_t numChunks;
+
+    /// The number of chunks the storage can hold
+    size_t capacity;
+
+    /// The allocator that provides the storage of chunks and containers
+    Allocator* allocator;
+
+#ifdef DEBUG
+    friend class CompressedBitVectorTest;
+#endif
+
+    // MARK: Memory Management
+
+    ///
+    /// Allocate an array of the given type
+    ///
+    /// @param count The number of elements
+    /// @return The array on success, `nullptr` if the allocator is out of memory.
+    ///
+    template <typename T>
+    inline T* allocate(size_t count)
+    {
+        return reinterpret_cast<T*>(this->allocator->allocate(count * sizeof(T)));
+    }
+
+    ///
+    /// Release an array returned by `allocate()`
+    ///
+    /// @param array The array to release
+    /// @param count The number of elements
+    ///
+    template <typename T>
+    inline void deallocate(T* array, size_t count)
+    {
+        if (array != nullptr)
+        {
+            this->allocator->deallocate(array, count * sizeof(T));
+        }
+    }
+
+    ///
+    /// Ensure that the given array has room for the given number of elements
+    ///
+    /// @param array The array that is reallocated on return if necessary
+    /// @param size The number of elements in use
+    /// @param capacity The number of elements the array can hold, which is updated on return
+    /// @param required The number of elements required
+    /// @return `true` on success, `false` if the allocator is out of memory, in which case the array is unchanged.
+    /// @note The capacity is at least doubled whenever the array grows.
+    ///
+    template <typename T, typename Size>
+    bool reserve(T*& array, size_t size, Size& capacity, size_t required)
+    {
+        // Guard: The array is large enough
+        if (required <= capacity)
+        {
+            return true;
+        }
+
+        size_t newCapacity = std::max({ required, static_cast<size_t>(capacity) * 2, static_cast<size_t>(MinCapacity) });
+
+        T* newArray = this->allocate<T>(newCapacity);
+
+        if (newArray == nullptr)
+        {
+            perr("Failed to allocate an array of %lu elements.", newCapacity);
+
+            return false;
+        }
+
+        std::copy(array, array + size, newArray);
+
+        this->deallocate(array, capacity);
+
+        array = newArray;
+
+        capacity = static_cast<Size>(newCapacity);
+
+        return true;
+    }
+
+    ///
+    /// Ensure that the container of the given chunk has room for the given number of elements
+    ///
+    /// @param chunk An array chunk or a run chunk
+    /// @param required The number of elements required
+    /// @return `true` on success, `false` if the allocator is out of memory.
+    ///
+    template <typename T>
+    inline bool reserveContainer(Chunk& chunk, size_t required)
+    {
+        T* array = reinterpret_cast<T*>(chunk.storage);
+
+        if (!this->reserve(array, chunk.size, chunk.capacity, required))
+        {
+            return false;
+        }
+
+        chunk.storage = array;
+
+        return true;
+    }
+
+    ///
+    /// Release the container of the given chunk
+    ///
+    /// @param chunk A chunk
+    ///
+    void releaseContainer(Chunk& chunk)
+    {
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+                this->deallocate(chunk.values(), chunk.capacity);
+                break;
+
+            case ContainerType::Bitmap:
+                this->deallocate(chunk.bitmap(), 1);
+                break;
+
+            case ContainerType::Runs:
+                this->deallocate(chunk.runs(), chunk.capacity);
+                break;
+        }
+
+        chunk.storage = nullptr;
+
+        chunk.size = 0;
+
+        chunk.capacity = 0;
+    }
+
+    ///
+    /// Get the number of bytes used by the container of the given chunk
+    ///
+    /// @param chunk A chunk
+    /// @return The number of bytes allocated for the container.
+    ///
+    static inline size_t getContainerSize(const Chunk& chunk)
+    {
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+                return chunk.capacity * sizeof(uint16_t);
+
+            case ContainerType::Bitmap:
+                return sizeof(Bitmap);
+
+            case ContainerType::Runs:
+                return chunk.capacity * sizeof(Run);
+        }
+
+        return 0;
+    }
+
+    // MARK: Chunk Management
+
+    ///
+    /// Find the position of the first chunk whose key is not less than the given key
+    ///
+    /// @param key The high 16 bits of a bit index
+    /// @return The position of the chunk, `numChunks` if all chunks have smaller keys.
+    ///
+    [[nodiscard]]
+    inline size_t findChunkPosition(uint16_t key) const
+    {
+        return std::lower_bound(this->chunks, this->chunks + this->numChunks, key, [](const Chunk& chunk, uint16_t key) -> bool { return chunk.key < key; }) - this->chunks;
+    }
+
+    ///
+    /// Get the chunk that has the given key
+    ///
+    /// @param key The high 16 bits of a bit index
+    /// @return The chunk if it exists, `nullptr` otherwise.
+    ///
+    [[nodiscard]]
+    inline Chunk* getChunk(uint16_t key) const
+    {
+        size_t position = this->findChunkPosition(key);
+
+        return position < this->numChunks && this->chunks[position].key == key ? &this->chunks[position] : nullptr;
+    }
+
+    ///
+    /// Insert an empty array chunk with the given key at the given position
+    ///
+    /// @param position The position of the new chunk
+    /// @param key The high 16 bits of all bits in the chunk
+    /// @return `true` on success, `false` if the allocator is out of memory.
+    ///
+    bool insertChunk(size_t position, uint16_t key)
+    {
+        if (!this->reserve(this->chunks, this->numChunks, this->capacity, this->numChunks + 1))
+        {
+            return false;
+        }
+
+        std::copy_backward(this->chunks + position, this->chunks + this->numChunks, this->chunks + this->numChunks + 1);
+
+        this->chunks[position] = { key, ContainerType::Array, 0, 0, 0, nullptr };
+
+        this->numChunks += 1;
+
+        return true;
+    }
+
+    ///
+    /// Remove the chunk at the given position and release its container
+    ///
+    /// @param position The position of the chunk
+    ///
+    void removeChunk(size_t position)
+    {
+        this->releaseContainer(this->chunks[position]);
+
+        std::copy(this->chunks + position + 1, this->chunks + this->numChunks, this->chunks + position);
+
+        this->numChunks -= 1;
+    }
+
+    // MARK: Container Conversions
+
+    ///
+    /// Convert the container of the given chunk to a bitmap
+    ///
+    /// @param chunk An array chunk or a run chunk
+    /// @return `true` on success, `false` if the allocator is out of memory, in which case the chunk is unchanged.
+    ///
+    bool convertToBitmap(Chunk& chunk)
+    {
+        Bitmap* bitmap = this->allocate<Bitmap>(1);
+
+        if (bitmap == nullptr)
+        {
+            perr("Failed to allocate a bitmap container.");
+
+            return false;
+        }
+
+        bitmap->initWithZeros();
+
+        if (chunk.type == ContainerType::Array)
+        {
+            std::for_each(chunk.values(), chunk.values() + chunk.size, [&](uint16_t value) -> void { bitmap->setBit(value); });
+        }
+        else
+        {
+            std::for_each(chunk.runs(), chunk.runs() + chunk.size, [&](const Run& run) -> void { bitmap->setBits(ClosedRange<size_t>(run.first, run.last)); });
+        }
+
+        this->releaseContainer(chunk);
+
+        chunk.type = ContainerType::Bitmap;
+
+        chunk.storage = bitmap;
+
+        return true;
+    }
+
+    ///
+    /// Convert the container of the given chunk to an array
+    ///
+    /// @param chunk A bitmap chunk that has no more than `MaxArraySize` bits set
+    /// @return `true` on success, `false` if the allocator is out of memory, in which case the chunk is unchanged.
+    ///
+    bool convertBitmapToArray(Chunk& chunk)
+    {
+        uint16_t* values = this->allocate<uint16_t>(chunk.cardinality);
+
+        if (values == nullptr)
+        {
+            return false;
+        }
+
+        uint16_t* value = values;
+
+        chunk.bitmap()->forEachSetBit([&](size_t index) -> void { *value++ = static_cast<uint16_t>(index); });
+
+        this->releaseContainer(chunk);
+
+        chunk.type = ContainerType::Array;
+
+        chunk.storage = values;
+
+        chunk.size = chunk.cardinality;
+
+        chunk.capacity = chunk.cardinality;
+
+        return true;
+    }
+
+    ///
+    /// Convert the container of the given chunk to runs
+    ///
+    /// @param chunk An array chunk or a bitmap chunk
+    /// @param numRuns The number of runs of consecutive set bits in the chunk
+    /// @return `true` on success, `false` if the allocator is out of memory, in which case the chunk is unchanged.
+    ///
+    bool convertToRuns(Chunk& chunk, uint32_t numRuns)
+    {
+        Run* runs = this->allocate<Run>(numRuns);
+
+        if (runs == nullptr)
+        {
+            return false;
+        }
+
+        Run* run = runs - 1;
+
+        auto append = [&](size_t index) -> void
+        {
+            // Extend the current run or start a new one
+            if (run >= runs && run->last + 1u == index)
+            {
+                run->last = static_cast<uint16_t>(index);
+            }
+            else
+            {
+                *++run = { static_cast<uint16_t>(index), static_cast<uint16_t>(index) };
+            }
+        };
+
+        if (chunk.type == ContainerType::Array)
+        {
+            std::for_each(chunk.values(), chunk.values() + chunk.size, append);
+        }
+        else
+        {
+            chunk.bitmap()->forEachSetBit(append);
+        }
+
+        this->releaseContainer(chunk);
+
+        chunk.type = ContainerType::Runs;
+
+        chunk.storage = runs;
+
+        chunk.size = numRuns;
+
+        chunk.capacity = numRuns;
+
+        return true;
+    }
+
+    ///
+    /// Count the number of runs of consecutive set bits in the given chunk
+    ///
+    /// @param chunk A chunk
+    /// @return The number of runs.
+    ///
+    static uint32_t countRuns(const Chunk& chunk)
+    {
+        uint32_t numRuns = 0;
+
+        int64_t previous = -2;
+
+        auto visit = [&](size_t index) -> void
+        {
+            if (static_cast<int64_t>(index) != previous + 1)
+            {
+                numRuns += 1;
+            }
+
+            previous = static_cast<int64_t>(index);
+        };
+
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+                std::for_each(chunk.values(), chunk.values() + chunk.size, visit);
+                break;
+
+            case ContainerType::Bitmap:
+                chunk.bitmap()->forEachSetBit(visit);
+                break;
+
+            case ContainerType::Runs:
+                numRuns = chunk.size;
+                break;
+        }
+
+        return numRuns;
+    }
+
+    // MARK: Run Containers
+
+    ///
+    /// Find the position of the first run that ends at or after the given value
+    ///
+    /// @param chunk A run chunk
+    /// @param value The low 16 bits of a bit index
+    /// @return The position of the run, `chunk.size` if all runs end before the given value.
+    ///
+    static inline uint32_t findRunPosition(const Chunk& chunk, uint16_t value)
+    {
+        return std::lower_bound(chunk.runs(), chunk.runs() + chunk.size, value, [](const Run& run, uint16_t value) -> bool { return run.last < value; }) - chunk.runs();
+    }
+
+    ///
+    /// Set the given bit in a run chunk
+    ///
+    /// @param chunk A run chunk that does not contain the given value
+    /// @param value The low 16 bits of a bit index
+    /// @return `true` on success, `false` if the allocator is out of memory.
+    ///
+    bool insertIntoRuns(Chunk& chunk, uint16_t value)
+    {
+        uint32_t position = findRunPosition(chunk, value);
+
+        Run* runs = chunk.runs();
+
+        bool extendsPrevious = position > 0 && runs[position - 1].last + 1u == value;
+
+        bool extendsNext = position < chunk.size && runs[position].first == value + 1u;
+
+        if (extendsPrevious && extendsNext)
+        {
+            // The value fills the gap between two runs
+            runs[position - 1].last = runs[position].last;
+
+            std::copy(runs + position + 1, runs + chunk.size, runs + position);
+
+            chunk.size -= 1;
+        }
+        else if (extendsPrevious)
+        {
+            runs[position - 1].last = value;
+        }
+        else if (extendsNext)
+        {
+            runs[position].first = value;
+        }
+        else
+        {
+            // Guard: The run container would become larger than a bitmap
+            if (chunk.size == MaxNumRuns)
+            {
+                if (!this->convertToBitmap(chunk))
+                {
+                    return false;
+                }
+
+                chunk.bitmap()->setBit(value);
+
+                chunk.cardinality += 1;
+
+                return true;
+            }
+
+            if (!this->reserveContainer<Run>(chunk, chunk.size + 1))
+            {
+                return false;
+            }
+
+            runs = chunk.runs();
+
+            std::copy_backward(runs + position, runs + chunk.size, runs + chunk.size + 1);
+
+            runs[position] = { value, value };
+
+            chunk.size += 1;
+        }
+
+        chunk.cardinality += 1;
+
+        return true;
+    }
+
+    ///
+    /// Clear the given bit in a run chunk
+    ///
+    /// @param chunk A run chunk that contains the given value
+    /// @param value The low 16 bits of a bit index
+    /// @return `true` on success, `false` if the allocator is out of memory.
+    ///
+    bool removeFromRuns(Chunk& chunk, uint16_t value)
+    {
+        uint32_t position = findRunPosition(chunk, value);
+
+        Run* runs = chunk.runs();
+
+        Run& run = runs[position];
+
+        if (run.first == run.last)
+        {
+            std::copy(runs + position + 1, runs + chunk.size, runs + position);
+
+            chunk.size -= 1;
+        }
+        else if (run.first == value)
+        {
+            run.first += 1;
+        }
+        else if (run.last == value)
+        {
+            run.last -= 1;
+        }
+        else
+        {
+            // The value splits the run into two
+            // Guard: The run container would become larger than a bitmap
+            if (chunk.size == MaxNumRuns)
+            {
+                if (!this->convertToBitmap(chunk))
+                {
+                    return false;
+                }
+
+                chunk.bitmap()->clearBit(value);
+
+                chunk.cardinality -= 1;
+
+                return true;
+            }
+
+            if (!this->reserveContainer<Run>(chunk, chunk.size + 1))
+            {
+                return false;
+            }
+
+            runs = chunk.runs();
+
+            std::copy_backward(runs + position + 1, runs + chunk.size, runs + chunk.size + 1);
+
+            runs[position + 1] = { static_cast<uint16_t>(value + 1), runs[position].last };
+
+            runs[position].last = value - 1;
+
+            chunk.size += 1;
+        }
+
+        chunk.cardinality -= 1;
+
+        return true;
+    }
+
+    // MARK: Container Queries
+
+    ///
+    /// Check whether the given chunk contains the given value
+    ///
+    /// @param chunk A chunk
+    /// @param value The low 16 bits of a bit index
+    /// @return `true` if the bit is set, `false` otherwise.
+    ///
+    static bool containsValue(const Chunk& chunk, uint16_t value)
+    {
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+                return std::binary_search(chunk.values(), chunk.values() + chunk.size, value);
+
+            case ContainerType::Bitmap:
+                return chunk.bitmap()->containsBit(value);
+
+            case ContainerType::Runs:
+            {
+                uint32_t position = findRunPosition(chunk, value);
+
+                return position < chunk.size && chunk.runs()[position].first <= value;
+            }
+        }
+
+        return false;
+    }
+
+    ///
+    /// Find the first set bit at or after the given value in the given chunk
+    ///
+    /// @param chunk A chunk
+    /// @param value The low 16 bits of a bit index where the search starts
+    /// @return The low 16 bits of the next set bit on success, `-1` if no such bit exists in the chunk.
+    ///
+    static int32_t findNextValue(const Chunk& chunk, uint16_t value)
+    {
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+            {
+                const uint16_t* next = std::lower_bound(chunk.values(), chunk.values() + chunk.size, value);
+
+                return next < chunk.values() + chunk.size ? *next : -1;
+            }
+
+            case ContainerType::Bitmap:
+                return static_cast<int32_t>(chunk.bitmap()->findNextSetBit(value));
+
+            case ContainerType::Runs:
+            {
+                uint32_t position = findRunPosition(chunk, value);
+
+                return position < chunk.size ? std::max(chunk.runs()[position].first, value) : -1;
+            }
+        }
+
+        return -1;
+    }
+
+    ///
+    /// Find the last set bit in the given chunk
+    ///
+    /// @param chunk A non-empty chunk
+    /// @return The low 16 bits of the last set bit.
+    ///
+    static uint16_t findLastValue(const Chunk& chunk)
+    {
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+                return chunk.values()[chunk.size - 1];
+
+            case ContainerType::Bitmap:
+                return static_cast<uint16_t>(chunk.bitmap()->findMostSignificantBitIndex());
+
+            case ContainerType::Runs:
+                return chunk.runs()[chunk.size - 1].last;
+        }
+
+        return 0;
+    }
+
+    /// Combine the key of a chunk and the low 16 bits into a bit index
+    /// The index is widened to 64 bits, so that every 32-bit index stays non-negative even if `ssize_t` has 32 bits
+    static inline int64_t makeIndex(uint16_t key, uint16_t value)
+    {
+        return static_cast<int64_t>((static_cast<uint32_t>(key) << 16) | value);
+    }
+
+public:
+    ///
+    /// Create an empty compressed bit vector
+    ///
+    /// @param allocator An allocator that outlives the vector
+    ///
+    explicit CompressedBitVector(Allocator* allocator) :
+        chunks(nullptr), numChunks(0), capacity(0), allocator(allocator) {}
+
+    /// A bit vector cannot be copied, because it owns its storage
+    CompressedBitVector(const CompressedBitVector&) = delete;
+
+    /// A bit vector cannot be copied, because it owns its storage
+    CompressedBitVector& operator=(const CompressedBitVector&) = delete;
+
+    /// Release all chunks and containers
+    ~CompressedBitVector()
+    {
+        this->initWithZeros();
+
+        this->deallocate(this->chunks, this->capacity);
+    }
+
+    /// Clear all bits and release all containers
+    void initWithZeros()
+    {
+        for (size_t position = 0; position < this->numChunks; position += 1)
+        {
+            this->releaseContainer(this->chunks[position]);
+        }
+
+        this->numChunks = 0;
+    }
+
+    // MARK: Examine a bit in the vector
+
+    ///
+    /// Check whether the given bit is set in the vector
+    ///
+    /// @param index Index of the bit
+    /// @return `true` if the bit at the given index is set, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool containsBit(uint32_t index) const
+    {
+        const Chunk* chunk = this->getChunk(index >> 16);
+
+        return chunk != nullptr && containsValue(*chunk, static_cast<uint16_t>(index));
+    }
+
+    ///
+    /// Get the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The bit at the given index.
+    ///
+    [[nodiscard]]
+    inline uint8_t getBit(uint32_t index) const
+    {
+        return this->containsBit(index) ? 1 : 0;
+    }
+
+    ///
+    /// Set the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @return `true` on success, `false` if the allocator is out of memory, in which case the bit remains clear.
+    ///
+    bool setBit(uint32_t index)
+    {
+        uint16_t key = index >> 16, value = static_cast<uint16_t>(index);
+
+        size_t position = this->findChunkPosition(key);
+
+        // Create the chunk if this is its first bit
+        if (position == this->numChunks || this->chunks[position].key != key)
+        {
+            if (!this->insertChunk(position, key))
+            {
+                return false;
+            }
+        }
+
+        Chunk& chunk = this->chunks[position];
+
+        // Guard: The bit is already set
+        if (containsValue(chunk, value))
+        {
+            return true;
+        }
+
+        bool succeeded = true;
+
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+            {
+                // Guard: The array container would become larger than a bitmap
+                if (chunk.size == MaxArraySize)
+                {
+                    if (!this->convertToBitmap(chunk))
+                    {
+                        return false;
+                    }
+
+                    chunk.bitmap()->setBit(value);
+
+                    break;
+                }
+
+                if (!this->reserveContainer<uint16_t>(chunk, chunk.size + 1))
+                {
+                    succeeded = false;
+
+                    break;
+                }
+
+                uint16_t* values = chunk.values();
+
+                uint16_t* next = std::lower_bound(values, values + chunk.size, value);
+
+                std::copy_backward(next, values + chunk.size, values + chunk.size + 1);
+
+                *next = value;
+
+                chunk.size += 1;
+
+                break;
+            }
+
+            case ContainerType::Bitmap:
+                chunk.bitmap()->setBit(value);
+
+                break;
+
+            case ContainerType::Runs:
+                // The run container maintains its own cardinality
+                return this->insertIntoRuns(chunk, value);
+        }
+
+        if (!succeeded)
+        {
+            // Guard: Remove the chunk created for this bit
+            if (chunk.cardinality == 0)
+            {
+                this->removeChunk(position);
+            }
+
+            return false;
+        }
+
+        chunk.cardinality += 1;
+
+        return true;
+    }
+
+    ///
+    /// Clear the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @return `true` on success, `false` if the allocator is out of memory, in which case the bit remains set.
+    /// @note Clearing a bit in the middle of a run splits the run, which is the only case that allocates memory.
+    ///
+    bool clearBit(uint32_t index)
+    {
+        uint16_t key = index >> 16, value = static_cast<uint16_t>(index);
+
+        size_t position = this->findChunkPosition(key);
+
+        // Guard: The bit is not set
+        if (position == this->numChunks || this->chunks[position].key != key || !containsValue(this->chunks[position], value))
+        {
+            return true;
+        }
+
+        Chunk& chunk = this->chunks[position];
+
+        switch (chunk.type)
+        {
+            case ContainerType::Array:
+            {
+                uint16_t* values = chunk.values();
+
+                uint16_t* current = std::lower_bound(values, values + chunk.size, value);
+
+                std::copy(current + 1, values + chunk.size, current);
+
+                chunk.size -= 1;
+
+                chunk.cardinality -= 1;
+
+                break;
+            }
+
+            case ContainerType::Bitmap:
+            {
+                chunk.bitmap()->clearBit(value);
+
+                chunk.cardinality -= 1;
+
+                // Switch back to an array once the bitmap is half as dense as the threshold,
+                // so that setting and clearing a bit around the threshold does not convert the container each time.
+                // Failing to allocate the array is fine, because the bitmap remains valid.
+                if (chunk.cardinality > 0 && chunk.cardinality <= MaxArraySize / 2)
+                {
+                    this->convertBitmapToArray(chunk);
+                }
+
+                break;
+            }
+
+            case ContainerType::Runs:
+            {
+                if (!this->removeFromRuns(chunk, value))
+                {
+                    return false;
+                }
+
+                break;
+            }
+        }
+
+        // Release the chunk once it becomes empty
+        if (chunk.cardinality == 0)
+        {
+            this->removeChunk(position);
+        }
+
+        return true;
+    }
+
+    // MARK: Search for a set bit
+
+    ///
+    /// Find the position of the least significant bit
+    ///
+    /// @return Index of the least significant bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    int64_t findLeastSignificantBitIndex() const
+    {
+        // Guard: The vector is empty
+        if (this->numChunks == 0)
+        {
+            return -1;
+        }
+
+        return makeIndex(this->chunks[0].key, static_cast<uint16_t>(findNextValue(this->chunks[0], 0)));
+    }
+
+    ///
+    /// Find the position of the most significant bit
+    ///
+    /// @return Index of the most significant bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    int64_t findMostSignificantBitIndex() const
+    {
+        // Guard: The vector is empty
+        if (this->numChunks == 0)
+        {
+            return -1;
+        }
+
+        const Chunk& chunk = this->chunks[this->numChunks - 1];
+
+        return makeIndex(chunk.key, findLastValue(chunk));
+    }
+
+    ///
+    /// Find the position of the first set bit at or after the given index
+    ///
+    /// @param from Index of the bit where the search starts
+    /// @return The absolute index of the next set bit on success, `-1` if no such bit exists.
+    /// @note The bit at `from` is included in the search.
+    ///
+    [[nodiscard]]
+    int64_t findNextSetBit(uint32_t from) const
+    {
+        uint16_t key = from >> 16;
+
+        size_t position = this->findChunkPosition(key);
+
+        // Search the rest of the chunk that contains the given index
+        if (position < this->numChunks && this->chunks[position].key == key)
+        {
+            int32_t value = findNextValue(this->chunks[position], static_cast<uint16_t>(from));
+
+            if (value >= 0)
+            {
+                return makeIndex(key, static_cast<uint16_t>(value));
+            }
+
+            position += 1;
+        }
+
+        // The next chunk always has a set bit
+        if (position < this->numChunks)
+        {
+            return makeIndex(this->chunks[position].key, static_cast<uint16_t>(findNextValue(this->chunks[position], 0)));
+        }
+
+        return -1;
+    }
+
+    // MARK: Count bits in the vector
+
+    ///
+    /// Count the number of set bits in the vector
+    ///
+    /// @return The number of set bits.
+    ///
+    [[nodiscard]]
+    size_t count() const
+    {
+        size_t count = 0;
+
+        for (size_t position = 0; position < this->numChunks; position += 1)
+        {
+            count += this->chunks[position].cardinality;
+        }
+
+        return count;
+    }
+
+    // MARK: Manage the storage
+
+    ///
+    /// Convert each chunk to runs if runs take less memory than its current container
+    ///
+    /// @note This function suits vectors that have long runs of set bits, e.g. after a range of IDs is reserved.
+    ///       Chunks that fail to allocate runs keep their current containers.
+    ///
+    void optimize()
+    {
+        for (size_t position = 0; position < this->numChunks; position += 1)
+        {
+            Chunk& chunk = this->chunks[position];
+
+            // Guard: The chunk already uses runs
+            if (chunk.type == ContainerType::Runs)
+            {
+                continue;
+            }
+
+            uint32_t numRuns = countRuns(chunk);
+
+            // Compare against the values in use rather than the capacity, so that spare room in an array does not count
+            size_t size = chunk.type == ContainerType::Array ? chunk.size * sizeof(uint16_t) : sizeof(Bitmap);
+
+            if (numRuns * sizeof(Run) < size)
+            {
+                this->convertToRuns(chunk, numRuns);
+            }
+        }
+    }
+
+    ///
+    /// Get the number of bytes used by the vector
+    ///
+    /// @return The number of bytes used by the vector itself, the chunks and the containers.
+    ///
+    [[nodiscard]]
+    size_t getMemoryUsage() const
+    {
+        size_t usage = sizeof(*this) + this->capacity * sizeof(Chunk);
+
+        for (size_t position = 0; position < this->numChunks; position += 1)
+        {
+            usage += getContainerSize(this->chunks[position]);
+        }
+
+        return usage;
+    }
+};
+
+#endif /* CompressedBitVector_hpp */
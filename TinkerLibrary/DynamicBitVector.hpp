@@ -0,0 +1,245 @@
+//
+//  DynamicBitVector.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef DynamicBitVector_hpp
+#define DynamicBitVector_hpp
+
+#include "BitVectorBase.hpp"
+#include "BitVectorAllocator.hpp"
+
+///
+/// A dynamic bit vector manages a number of bit values, either 0 or 1, that is only known at runtime.
+/// It provides the same interface as `StaticBitVector`, because both are built on top of `BitVectorBase`.
+///
+/// Storage comes from a buffer supplied by the caller, from an allocator, or from both:
+/// The vector starts with the buffer if one is given, and moves to memory returned by the allocator once the buffer is full.
+/// The vector never allocates memory for individual bits. It grows the storage by doubling the capacity,
+/// and copies existing blocks as a whole to the new storage, so the amortized cost of growing is constant per block.
+///
+/// Example: A frame allocator learns the number of physical pages from the memory map at boot.
+///
+/// ```
+/// DynamicBitVector<> frames(buffer, sizeof(buffer));
+///
+/// frames.resize(numPages);
+///
+/// frames.initWithOnes();
+/// ```
+///
+/// @tparam StorageUnit Specify the underlying integer type to store bits
+/// @tparam Allocator Specify the type of the allocator that provides the storage once the buffer is full
+///
+template <typename StorageUnit = size_t, typename Allocator = NullBitVectorAllocator>
+requires std::unsigned_integral<StorageUnit> && BitVectorAllocator<Allocator>
+class DynamicBitVector: public BitVectorBase<DynamicBitVector<StorageUnit, Allocator>, StorageUnit>
+{
+private:
+    /// The common implementation
+    using Base = BitVectorBase<DynamicBitVector<StorageUnit, Allocator>, StorageUnit>;
+
+    /// Compile time constant that stores the number of bits stored in each `BitOptions` block
+    static constexpr size_t NumBitsPerOptionsBlock = Base::NumBitsPerOptionsBlock;
+
+    /// The internal storage
+    BitOptions<StorageUnit>* blocks;
+
+    /// The total number of bits
+    size_t numBits;
+
+    /// The number of blocks available in the internal storage
+    size_t capacity;
+
+    /// The allocator that provides the storage once the buffer is full, `nullptr` if the vector cannot grow beyond the buffer
+    Allocator* allocator;
+
+    /// `true` if the internal storage is allocated by the allocator, `false` if it is supplied by the caller
+    bool ownsBlocks;
+
+    /// The common implementation examines the blocks directly
+    friend Base;
+
+#ifdef DEBUG
+    friend class DynamicBitVectorTest;
+#endif
+
+    ///
+    /// Get the number of blocks required to store the given number of bits
+    ///
+    /// @param numBits The number of bits
+    /// @return The number of blocks.
+    ///
+    static inline size_t bits2Blocks(size_t numBits)
+    {
+        return (numBits + NumBitsPerOptionsBlock - 1) / NumBitsPerOptionsBlock;
+    }
+
+    ///
+    /// Move the existing blocks to a new storage that has the given number of blocks
+    ///
+    /// @param newCapacity The number of blocks in the new storage
+    /// @return `true` on success, `false` if the allocator is not available or is out of memory.
+    /// @note The content of blocks beyond the existing ones is undefined on return.
+    ///
+    bool reallocate(size_t newCapacity)
+    {
+        // Guard: The vector is confined to the buffer supplied by the caller
+        if (this->allocator == nullptr)
+        {
+            perr("Cannot grow the storage to %lu blocks without an allocator.", newCapacity);
+
+            return false;
+        }
+
+        auto* newBlocks = reinterpret_cast<BitOptions<StorageUnit>*>(this->allocator->allocate(newCapacity * sizeof(StorageUnit)));
+
+        if (newBlocks == nullptr)
+        {
+            perr("Failed to allocate the storage of %lu blocks.", newCapacity);
+
+            return false;
+        }
+
+        // Copy the existing blocks as a whole, so no bit needs to be examined again
+        for (size_t index = 0; index < bits2Blocks(this->numBits); index += 1)
+        {
+            newBlocks[index] = this->blocks[index];
+        }
+
+        this->releaseBlocks();
+
+        this->blocks = newBlocks;
+
+        this->capacity = newCapacity;
+
+        this->ownsBlocks = true;
+
+        return true;
+    }
+
+    /// Release the internal storage if it is allocated by the allocator
+    void releaseBlocks()
+    {
+        if (this->ownsBlocks)
+        {
+            this->allocator->deallocate(this->blocks, this->capacity * sizeof(StorageUnit));
+        }
+    }
+
+public:
+    ///
+    /// Create an empty bit vector that takes its storage from the given allocator
+    ///
+    /// @param allocator An allocator that outlives the vector, `nullptr` if the vector should never allocate memory
+    ///
+    explicit DynamicBitVector(Allocator* allocator = nullptr) :
+        blocks(nullptr), numBits(0), capacity(0), allocator(allocator), ownsBlocks(false) {}
+
+    ///
+    /// Create an empty bit vector that takes its storage from the given buffer first
+    ///
+    /// @param buffer A buffer that outlives the vector and is aligned to the size of the storage unit
+    /// @param size The number of bytes in the buffer
+    /// @param allocator An allocator that outlives the vector, `nullptr` if the vector should never grow beyond the buffer
+    /// @note The caller remains responsible for releasing the buffer.
+    ///
+    DynamicBitVector(void* buffer, size_t size, Allocator* allocator = nullptr) :
+        blocks(reinterpret_cast<BitOptions<StorageUnit>*>(buffer)), numBits(0), capacity(size / sizeof(StorageUnit)), allocator(allocator), ownsBlocks(false) {}
+
+    /// A bit vector cannot be copied, because it might own its storage
+    DynamicBitVector(const DynamicBitVector&) = delete;
+
+    /// A bit vector cannot be copied, because it might own its storage
+    DynamicBitVector& operator=(const DynamicBitVector&) = delete;
+
+    /// Release the storage allocated by the allocator
+    ~DynamicBitVector()
+    {
+        this->releaseBlocks();
+    }
+
+    ///
+    /// Get the total number of bits in the vector
+    ///
+    /// @return The number of bits.
+    ///
+    [[nodiscard]]
+    inline size_t getNumBits() const
+    {
+        return this->numBits;
+    }
+
+    ///
+    /// Get the number of bits that the vector can hold without allocating memory
+    ///
+    /// @return The number of bits.
+    ///
+    [[nodiscard]]
+    inline size_t getCapacity() const
+    {
+        return this->capacity * NumBitsPerOptionsBlock;
+    }
+
+    // MARK: Manage the storage
+
+    ///
+    /// Ensure that the vector can hold the given number of bits without allocating memory
+    ///
+    /// @param numBits The number of bits
+    /// @return `true` on success, `false` if the storage cannot grow.
+    /// @note The capacity is at least doubled whenever the storage grows.
+    ///
+    bool reserve(size_t numBits)
+    {
+        size_t required = bits2Blocks(numBits);
+
+        // Guard: The storage is large enough
+        if (required <= this->capacity)
+        {
+            return true;
+        }
+
+        return this->reallocate(required > this->capacity * 2 ? required : this->capacity * 2);
+    }
+
+    ///
+    /// Change the number of bits in the vector
+    ///
+    /// @param numBits The new number of bits
+    /// @return `true` on success, `false` if the storage cannot grow, in which case the vector is unchanged.
+    /// @note Existing bits keep their values, while new bits are zero.
+    ///
+    bool resize(size_t numBits)
+    {
+        if (!this->reserve(numBits))
+        {
+            return false;
+        }
+
+        size_t oldNumBlocks = bits2Blocks(this->numBits);
+
+        size_t newNumBlocks = bits2Blocks(numBits);
+
+        // Blocks that become in use might hold stale bits from an earlier, larger size
+        for (size_t index = oldNumBlocks; index < newNumBlocks; index += 1)
+        {
+            this->blocks[index].clearAll();
+        }
+
+        this->numBits = numBits;
+
+        // Zero out "nonexistent" bits in the last block if the vector shrinks
+        if (numBits != 0 && newNumBlocks <= oldNumBlocks)
+        {
+            this->blocks[newNumBlocks - 1].mutativeBitwiseAnd(this->getLastBlockMask());
+        }
+
+        return true;
+    }
+};
+
+#endif /* DynamicBitVector_hpp */
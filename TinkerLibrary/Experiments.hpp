@@ -8,9 +8,33 @@
 #ifndef Experiments_hpp
 #define Experiments_hpp
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+///
+/// Prevent the compiler from discarding a function call whose result is otherwise unused
+///
+/// @param result The result of the function call
+/// @note The compiler must also assume that the memory is modified, so that loop invariant calls are not hoisted.
+///
+template <typename T>
+static inline void preserveResult(const T& result)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(result) : "memory");
+#else
+    static const void* volatile sink;
+
+    sink = &result;
+#endif
+}
+
 /// Measures the execution time of a function call
 struct ExecutionTimeMeasurer
 {
@@ -36,7 +60,14 @@ struct ExecutionTimeMeasurer
             // Measure the execution time
             auto start = std::chrono::high_resolution_clock::now();
 
-            std::invoke(std::forward<Func>(func), std::forward<Args>(args)...);
+            if constexpr (std::is_void_v<std::invoke_result_t<Func, Args...>>)
+            {
+                std::invoke(std::forward<Func>(func), std::forward<Args>(args)...);
+            }
+            else
+            {
+                preserveResult(std::invoke(std::forward<Func>(func), std::forward<Args>(args)...));
+            }
 
             auto end = std::chrono::high_resolution_clock::now();
 
@@ -70,4 +101,39 @@ struct ExecutionTimeMeasurerWithResult
     }
 };
 
+/// The throughput of an operation
+struct Throughput
+{
+    /// The average execution time of a single operation in nanoseconds
+    double nanosecondsPerOperation;
+
+    /// The number of operations per second
+    double operationsPerSecond;
+};
+
+/// Measures the throughput of an operation that is applied many times in a function call
+struct ThroughputMeasurer
+{
+    ///
+    /// Measure the throughput of an operation
+    ///
+    /// @param trials Specify the number of trials to invoke the given function
+    /// @param numOperations Specify the number of operations performed by each function call
+    /// @param func A callable function that performs the operation `numOperations` times
+    /// @param args Zero or more arguments passed to the function
+    /// @return The throughput derived from the medium execution time.
+    /// @note The function should return a value that depends on all operations (e.g. the sum of results),
+    ///       so that the compiler cannot discard any of them.
+    ///
+    template <typename Func, typename... Args>
+    Throughput operator()(size_t trials, size_t numOperations, Func&& func, Args&&... args)
+    {
+        uint64_t duration = ExecutionTimeMeasurer{}(trials, std::forward<Func>(func), std::forward<Args>(args)...);
+
+        double nanoseconds = static_cast<double>(std::max<uint64_t>(duration, 1)) / static_cast<double>(std::max<size_t>(numOperations, 1));
+
+        return { nanoseconds, 1e9 / nanoseconds };
+    }
+};
+
 #endif /* Experiments_hpp */
@@ -0,0 +1,41 @@
+//
+//  Heapable.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef Heapable_hpp
+#define Heapable_hpp
+
+#include <concepts>
+
+///
+/// A type that can form an intrusive pairing heap
+///
+/// Each item links to its leftmost child and its right sibling, and back to its left sibling or its parent,
+/// so that an item can be detached from the heap without a search.
+/// The links have distinct names from those of `Listable`, so that an item can be in a list and a heap at the same time.
+///
+template <typename Item>
+class Heapable
+{
+public:
+    /// The leftmost child
+    Item* child;
+
+    /// The right sibling
+    Item* rightSibling;
+
+    /// The left sibling, or the parent if the item is the leftmost child
+    Item* leftSiblingOrParent;
+
+    Heapable() : child(nullptr), rightSibling(nullptr), leftSiblingOrParent(nullptr) {}
+};
+
+/// A concept to check whether a type is heapable
+template <typename Item>
+concept HeapableItem = std::derived_from<Item, Heapable<Item>>;
+
+#endif /* Heapable_hpp */
@@ -0,0 +1,754 @@
+//
+//  HierarchicalStaticBitVector.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef HierarchicalStaticBitVector_hpp
+#define HierarchicalStaticBitVector_hpp
+
+#include <type_traits>
+#include "StaticBitVector.hpp"
+
+///
+/// A hierarchical static bit vector manages a fixed number of bit values, either 0 or 1,
+/// and provides the same interface as `StaticBitVector` so that the caller can swap one for another.
+///
+/// Internally, it keeps a plain `StaticBitVector` as the leaf level, and a summary bit vector in which
+/// the bit at index `i` is set if and only if the `i`-th leaf block contains at least one bit set.
+/// The summary itself is hierarchical if it has more blocks than the number of bits in a single block,
+/// so each level shrinks the search space by a factor of `sizeof(StorageUnit) * 8`.
+///
+/// Searching for the least or the most significant bit, with or without a range,
+/// therefore touches a constant number of blocks per level, i.e. O(log64 N) on 64-bit systems,
+/// at the cost of updating the summary in `setBit()` and `clearBit()`.
+///
+/// Level Layout: (NumBits = 2^20, StorageUnit = UInt64)
+/// Leaves : 2^20 bits in 16384 blocks
+/// Summary: 16384 bits in 256 blocks   <- Hierarchical
+/// Summary: 256 bits in 4 blocks       <- Plain
+///
+/// @tparam NumBits Specify the total number of bits
+/// @tparam StorageUnit Specify the underlying integer type to store bits
+///
+template <size_t NumBits, typename StorageUnit = size_t>
+requires std::unsigned_integral<StorageUnit>
+class HierarchicalStaticBitVector
+{
+private:
+    /// The type of the leaf level
+    using Leaves = StaticBitVector<NumBits, StorageUnit>;
+
+    /// Compile time constant that stores the number of bits stored in each `BitOptions` block
+    static constexpr size_t NumBitsPerOptionsBlock = Leaves::NumBitsPerOptionsBlock;
+
+    /// Compile time constant that stores the actual number of options at the leaf level
+    static constexpr size_t NumOptionsBlocks = Leaves::NumOptionsBlocks;
+
+    /// The type of the summary level
+    /// Use a plain bit vector unless the summary has more blocks than the number of bits in a single block
+    using Summary = std::conditional_t<(NumOptionsBlocks > NumBitsPerOptionsBlock * NumBitsPerOptionsBlock),
+                                       HierarchicalStaticBitVector<NumOptionsBlocks, StorageUnit>,
+                                       StaticBitVector<NumOptionsBlocks, StorageUnit>>;
+
+    /// The leaf level that stores the actual bits
+    Leaves leaves;
+
+    /// The summary level that records which leaf blocks are not empty
+    Summary summary;
+
+    ///
+    /// Clear the summary bit of each leaf block that has become empty
+    ///
+    /// @note The summary must be a superset of the non-empty leaf blocks before this function is called.
+    ///
+    void pruneSummary()
+    {
+        for (ssize_t block = this->summary.findNextSetBit(0); block >= 0; block = this->summary.findNextSetBit(block + 1))
+        {
+            if (this->leaves.blocks[block].isEmpty())
+            {
+                this->summary.clearBit(block);
+            }
+        }
+    }
+
+#ifdef DEBUG
+    friend class HierarchicalStaticBitVectorTest;
+#endif
+
+public:
+    /// A forward iterator that visits the index of each set bit in ascending order
+    using SetBitIterator = typename Leaves::SetBitIterator;
+
+    // MARK: Create / Initialize a Bit Vector
+
+    /// Initialize the bit vector with all zeros
+    void initWithZeros()
+    {
+        this->leaves.initWithZeros();
+
+        this->summary.initWithZeros();
+    }
+
+    /// Initialize the bit vector with all ones
+    void initWithOnes()
+    {
+        // All leaf blocks contain at least one bit set,
+        // because the last block has at least one used bit.
+        this->leaves.initWithOnes();
+
+        this->summary.initWithOnes();
+    }
+
+    // MARK: Examine a bit in the vector
+
+    ///
+    /// Check whether the given bit is set in the vector
+    ///
+    /// @param index Index of the bit
+    /// @return `true` if the bit at the given index is set, `false` otherwise.
+    /// @warning The given index must be less than the total number of bits, otherwise `false` is returned.
+    ///
+    [[nodiscard]]
+    inline bool containsBit(size_t index) const
+    {
+        return this->leaves.containsBit(index);
+    }
+
+    ///
+    /// Get the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The bit at the given index.
+    /// @warning This function returns 0 if the given index is invalid.
+    ///
+    [[nodiscard]]
+    inline uint8_t getBit(size_t index) const
+    {
+        return this->leaves.getBit(index);
+    }
+
+    ///
+    /// Set the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    inline void setBit(size_t index)
+    {
+        // Guard: Ensure that the index is not out-of-bound
+        // Otherwise the summary bit of the last block might be set by mistake
+        if (index >= NumBits)
+        {
+            return;
+        }
+
+        this->leaves.setBit(index);
+
+        this->summary.setBit(index / NumBitsPerOptionsBlock);
+    }
+
+    ///
+    /// Clear the bit at the given index
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    inline void clearBit(size_t index)
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (!this->leaves.index2BlockOffset(index, block, offset))
+        {
+            return;
+        }
+
+        this->leaves.blocks[block].clearBit(offset);
+
+        // Guard: Update the summary if the block becomes empty
+        if (this->leaves.blocks[block].isEmpty())
+        {
+            this->summary.clearBit(block);
+        }
+    }
+
+    ///
+    /// Find the position of the least significant bit
+    ///
+    /// @return Index of the least significant bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    ssize_t findLeastSignificantBitIndex() const
+    {
+        // Find the first non-empty block via the summary
+        ssize_t block = this->summary.findLeastSignificantBitIndex();
+
+        if (block < 0)
+        {
+            return -1;
+        }
+
+        return block * NumBitsPerOptionsBlock + this->leaves.blocks[block].findLeastSignificantBitIndex();
+    }
+
+    ///
+    /// Find the position of the least significant bit in the given range
+    ///
+    /// @param range Specify the range when searching for the least significant bit
+    /// @return The absolute index of the least significant bit on success, `-1` if no such bit exists.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    ssize_t findLeastSignificantBitIndexWithRange(ClosedRange<Bound> range) const
+    {
+        // Find the first block and the last block in the range.
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->leaves.range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return -1;
+        }
+
+        // Guard: Check whether the first and the last block are the same
+        if (fblock == lblock)
+        {
+            return this->leaves.findLeastSignificantBitIndexWithRange(range);
+        }
+
+        // The first block is searched with out-of-bounds bits cleared
+        BitOptions<StorageUnit> fOptions = this->leaves.blocks[fblock].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsClear(foffset));
+
+        if (!fOptions.isEmpty())
+        {
+            // The LSB is in the first block
+            return fblock * NumBitsPerOptionsBlock + fOptions.findLeastSignificantBitIndex();
+        }
+
+        // Middle blocks are searched via the summary
+        if (fblock + 1 < lblock)
+        {
+            ssize_t block = this->summary.findLeastSignificantBitIndexWithRange(ClosedRange<size_t>(fblock + 1, lblock - 1));
+
+            if (block >= 0)
+            {
+                // The LSB is in a middle block
+                return block * NumBitsPerOptionsBlock + this->leaves.blocks[block].findLeastSignificantBitIndex();
+            }
+        }
+
+        // The last block is searched with out-of-bounds bits cleared
+        BitOptions<StorageUnit> lOptions = this->leaves.blocks[lblock].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsSet(loffset + 1));
+
+        if (!lOptions.isEmpty())
+        {
+            // The LSB is in the last block
+            return lblock * NumBitsPerOptionsBlock + lOptions.findLeastSignificantBitIndex();
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Find the position of the most significant bit
+    ///
+    /// @return Index of the most significant bit.
+    /// @warning This function returns -1 if no such bit exists.
+    ///
+    [[nodiscard]]
+    ssize_t findMostSignificantBitIndex() const
+    {
+        // Find the last non-empty block via the summary
+        ssize_t block = this->summary.findMostSignificantBitIndex();
+
+        if (block < 0)
+        {
+            return -1;
+        }
+
+        return block * NumBitsPerOptionsBlock + this->leaves.blocks[block].findMostSignificantBitIndex();
+    }
+
+    ///
+    /// Find the position of the most significant bit in the given range
+    ///
+    /// @param range Specify the range when searching for the most significant bit
+    /// @return The absolute index of the most significant bit on success, `-1` if no such bit exists.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    ssize_t findMostSignificantBitIndexWithRange(ClosedRange<Bound> range) const
+    {
+        // Find the first block and the last block in the range.
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->leaves.range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return -1;
+        }
+
+        // Guard: Check whether the first and the last block are the same
+        if (fblock == lblock)
+        {
+            return this->leaves.findMostSignificantBitIndexWithRange(range);
+        }
+
+        // The last block is searched with out-of-bounds bits cleared
+        BitOptions<StorageUnit> lOptions = this->leaves.blocks[lblock].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsSet(loffset + 1));
+
+        if (!lOptions.isEmpty())
+        {
+            // The MSB is in the last block
+            return lblock * NumBitsPerOptionsBlock + lOptions.findMostSignificantBitIndex();
+        }
+
+        // Middle blocks are searched via the summary
+        if (fblock + 1 < lblock)
+        {
+            ssize_t block = this->summary.findMostSignificantBitIndexWithRange(ClosedRange<size_t>(fblock + 1, lblock - 1));
+
+            if (block >= 0)
+            {
+                // The MSB is in a middle block
+                return block * NumBitsPerOptionsBlock + this->leaves.blocks[block].findMostSignificantBitIndex();
+            }
+        }
+
+        // The first block is searched with out-of-bounds bits cleared
+        BitOptions<StorageUnit> fOptions = this->leaves.blocks[fblock].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsClear(foffset));
+
+        if (!fOptions.isEmpty())
+        {
+            // The MSB is in the first block
+            return fblock * NumBitsPerOptionsBlock + fOptions.findMostSignificantBitIndex();
+        }
+
+        // Not found
+        return -1;
+    }
+
+    ///
+    /// Find the position of the first zero bit
+    ///
+    /// @return Index of the first zero bit.
+    /// @warning This function returns -1 if no such bit exists.
+    /// @note The summary only tracks non-empty blocks, so zero bits are searched at the leaf level.
+    ///
+    [[nodiscard]]
+    ssize_t findFirstZeroBitIndex() const
+    {
+        return this->leaves.findFirstZeroBitIndex();
+    }
+
+    ///
+    /// Find the position of the first zero bit in the given range
+    ///
+    /// @param range Specify the range when searching for the first zero bit
+    /// @return The absolute index of the first zero bit on success, `-1` if no such bit exists.
+    /// @note The summary only tracks non-empty blocks, so zero bits are searched at the leaf level.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    ssize_t findFirstZeroBitIndexWithRange(ClosedRange<Bound> range) const
+    {
+        return this->leaves.findFirstZeroBitIndexWithRange(range);
+    }
+
+    ///
+    /// Find the position of the first set bit at or after the given index
+    ///
+    /// @param from Index of the bit where the search starts
+    /// @return The absolute index of the next set bit on success, `-1` if no such bit exists.
+    /// @note The bit at `from` is included in the search.
+    ///
+    [[nodiscard]]
+    ssize_t findNextSetBit(size_t from) const
+    {
+        size_t block = 0, offset = 0;
+
+        // Guard: Verify the index and retrieve the block number and the offset
+        if (!this->leaves.index2BlockOffset(from, block, offset))
+        {
+            return -1;
+        }
+
+        // The current block is searched with bits before `from` cleared
+        BitOptions<StorageUnit> options = this->leaves.blocks[block].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsClear(offset));
+
+        if (!options.isEmpty())
+        {
+            return block * NumBitsPerOptionsBlock + options.findLeastSignificantBitIndex();
+        }
+
+        // Guard: The current block is the last one
+        if (block + 1 == NumOptionsBlocks)
+        {
+            return -1;
+        }
+
+        // Subsequent blocks are searched via the summary
+        ssize_t next = this->summary.findNextSetBit(block + 1);
+
+        if (next < 0)
+        {
+            return -1;
+        }
+
+        return next * NumBitsPerOptionsBlock + this->leaves.blocks[next].findLeastSignificantBitIndex();
+    }
+
+    ///
+    /// Find the position of the first zero bit at or after the given index
+    ///
+    /// @param from Index of the bit where the search starts
+    /// @return The absolute index of the next zero bit on success, `-1` if no such bit exists.
+    /// @note The bit at `from` is included in the search.
+    /// @note The summary only tracks non-empty blocks, so zero bits are searched at the leaf level.
+    ///
+    [[nodiscard]]
+    ssize_t findNextZeroBit(size_t from) const
+    {
+        return this->leaves.findNextZeroBit(from);
+    }
+
+    // MARK: Manipulate a range of bits in the vector
+
+    ///
+    /// Set all bits in the given range
+    ///
+    /// @param range Specify the range of bits to set
+    /// @warning This function has no effect if the given range is invalid.
+    ///
+    template <typename Bound = size_t>
+    void setBits(ClosedRange<Bound> range)
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->leaves.range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return;
+        }
+
+        this->leaves.template fillBits<true>(fblock, foffset, lblock, loffset);
+
+        // All blocks covered by the range become non-empty
+        this->summary.setBits(ClosedRange<size_t>(fblock, lblock));
+    }
+
+    ///
+    /// Clear all bits in the given range
+    ///
+    /// @param range Specify the range of bits to clear
+    /// @warning This function has no effect if the given range is invalid.
+    ///
+    template <typename Bound = size_t>
+    void clearBits(ClosedRange<Bound> range)
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->leaves.range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return;
+        }
+
+        this->leaves.template fillBits<false>(fblock, foffset, lblock, loffset);
+
+        // Middle blocks become empty, while the first and the last block might still contain bits
+        if (fblock + 1 < lblock)
+        {
+            this->summary.clearBits(ClosedRange<size_t>(fblock + 1, lblock - 1));
+        }
+
+        if (this->leaves.blocks[fblock].isEmpty())
+        {
+            this->summary.clearBit(fblock);
+        }
+
+        if (this->leaves.blocks[lblock].isEmpty())
+        {
+            this->summary.clearBit(lblock);
+        }
+    }
+
+    ///
+    /// Check whether all bits in the given range are set
+    ///
+    /// @param range Specify the range of bits to check
+    /// @return `true` if all bits in the given range are set, `false` otherwise or if the given range is invalid.
+    /// @note The summary only tracks non-empty blocks, so zero bits are searched at the leaf level.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    bool allSet(ClosedRange<Bound> range) const
+    {
+        return this->leaves.allSet(range);
+    }
+
+    ///
+    /// Check whether no bit in the given range is set
+    ///
+    /// @param range Specify the range of bits to check
+    /// @return `true` if all bits in the given range are clear, `false` otherwise or if the given range is invalid.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    bool noneSet(ClosedRange<Bound> range) const
+    {
+        size_t fblock, foffset;
+
+        size_t lblock, loffset;
+
+        if (!this->leaves.range2BlockOffsets(range, fblock, foffset, lblock, loffset))
+        {
+            return false;
+        }
+
+        return this->findLeastSignificantBitIndexWithRange(range) < 0;
+    }
+
+    ///
+    /// Set a run of bits starting at the given index
+    ///
+    /// @param start Index of the first bit
+    /// @param count The number of bits to set
+    /// @warning This function has no effect if the given run is empty or exceeds the end of the vector.
+    ///
+    void setRange(size_t start, size_t count)
+    {
+        // Guard: Ensure that the run is valid
+        if (count == 0 || start >= NumBits || count > NumBits - start)
+        {
+            return;
+        }
+
+        this->setBits(ClosedRange<size_t>::createWithLength(start, count));
+    }
+
+    ///
+    /// Clear a run of bits starting at the given index
+    ///
+    /// @param start Index of the first bit
+    /// @param count The number of bits to clear
+    /// @warning This function has no effect if the given run is empty or exceeds the end of the vector.
+    ///
+    void clearRange(size_t start, size_t count)
+    {
+        // Guard: Ensure that the run is valid
+        if (count == 0 || start >= NumBits || count > NumBits - start)
+        {
+            return;
+        }
+
+        this->clearBits(ClosedRange<size_t>::createWithLength(start, count));
+    }
+
+    ///
+    /// Find the first run of consecutive zero bits
+    ///
+    /// @param count The number of consecutive zero bits
+    /// @param alignment Specify the alignment of the index of the first bit in the run, `1` if no alignment is required
+    /// @return The index of the first bit in the run on success, `-1` if no such run exists.
+    /// @note The summary only tracks non-empty blocks, so zero bits are searched at the leaf level.
+    ///
+    [[nodiscard]]
+    ssize_t findContiguousZeroRun(size_t count, size_t alignment = 1) const
+    {
+        return this->leaves.findContiguousZeroRun(count, alignment);
+    }
+
+    // MARK: Count bits in the vector
+
+    ///
+    /// Count the number of set bits in the vector
+    ///
+    /// @return The number of set bits.
+    ///
+    [[nodiscard]]
+    size_t count() const
+    {
+        return this->leaves.count();
+    }
+
+    ///
+    /// Count the number of set bits before the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The number of set bits in the range `[0, index)`.
+    /// @note The number of all set bits is returned if the given index is not less than the total number of bits.
+    ///
+    [[nodiscard]]
+    size_t rank(size_t index) const
+    {
+        return this->leaves.rank(index);
+    }
+
+    ///
+    /// Find the position of the k-th set bit
+    ///
+    /// @param k Specify which set bit to find, starting from 0
+    /// @return The index of the k-th set bit on success, `-1` if the vector has no more than `k` bits set.
+    ///
+    [[nodiscard]]
+    ssize_t select(size_t k) const
+    {
+        return this->leaves.select(k);
+    }
+
+    // MARK: Combine bit vectors
+
+    ///
+    /// Intersect this bit vector with the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that keeps only bits set in both vectors.
+    ///
+    HierarchicalStaticBitVector& operator&=(const HierarchicalStaticBitVector& other)
+    {
+        this->leaves &= other.leaves;
+
+        // A block that is empty in either vector remains empty
+        this->summary &= other.summary;
+
+        this->pruneSummary();
+
+        return *this;
+    }
+
+    ///
+    /// Union this bit vector with the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that has bits set in either vector.
+    ///
+    HierarchicalStaticBitVector& operator|=(const HierarchicalStaticBitVector& other)
+    {
+        this->leaves |= other.leaves;
+
+        // A block is not empty if and only if it is not empty in either vector
+        this->summary |= other.summary;
+
+        return *this;
+    }
+
+    ///
+    /// Compute the symmetric difference between this bit vector and the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that has bits set in exactly one of the vectors.
+    ///
+    HierarchicalStaticBitVector& operator^=(const HierarchicalStaticBitVector& other)
+    {
+        this->leaves ^= other.leaves;
+
+        // A block that is empty in both vectors remains empty
+        this->summary |= other.summary;
+
+        this->pruneSummary();
+
+        return *this;
+    }
+
+    ///
+    /// Clear the bits in this bit vector that are set in the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return This bit vector that keeps only bits not set in the given vector.
+    ///
+    HierarchicalStaticBitVector& andNot(const HierarchicalStaticBitVector& other)
+    {
+        this->leaves.andNot(other.leaves);
+
+        // A block that is empty in this vector remains empty
+        this->pruneSummary();
+
+        return *this;
+    }
+
+    ///
+    /// Check whether this bit vector and the given one have any bit set in common
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return `true` if at least one bit is set in both vectors, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool intersects(const HierarchicalStaticBitVector& other) const
+    {
+        // Guard: The vectors have no non-empty block in common
+        if (!this->summary.intersects(other.summary))
+        {
+            return false;
+        }
+
+        return this->leaves.intersects(other.leaves);
+    }
+
+    ///
+    /// Check whether every bit set in this bit vector is also set in the given one
+    ///
+    /// @param other Another bit vector of the same size
+    /// @return `true` if this vector is a subset of the given vector, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool isSubsetOf(const HierarchicalStaticBitVector& other) const
+    {
+        // Guard: This vector has a non-empty block that is empty in the given vector
+        if (!this->summary.isSubsetOf(other.summary))
+        {
+            return false;
+        }
+
+        return this->leaves.isSubsetOf(other.leaves);
+    }
+
+    // MARK: Iterate over set bits in the vector
+
+    ///
+    /// Get an iterator to the index of the least significant set bit
+    ///
+    /// @return An iterator that visits the index of each set bit in ascending order.
+    ///
+    [[nodiscard]]
+    inline SetBitIterator begin() const
+    {
+        return this->leaves.begin();
+    }
+
+    ///
+    /// Get an iterator past the index of the most significant set bit
+    ///
+    /// @return An iterator that has visited all set bits.
+    ///
+    [[nodiscard]]
+    inline SetBitIterator end() const
+    {
+        return this->leaves.end();
+    }
+
+    ///
+    /// Call the given action on the index of each set bit in ascending order
+    ///
+    /// @param action A functor that takes the index of each set bit
+    /// @note This function visits non-empty blocks only by walking the summary.
+    ///
+    template <typename Action>
+    requires std::invocable<Action, size_t> && std::same_as<std::invoke_result_t<Action, size_t>, void>
+    void forEachSetBit(Action action) const
+    {
+        this->summary.forEachSetBit([&](size_t block) -> void
+        {
+            size_t base = block * NumBitsPerOptionsBlock;
+
+            this->leaves.blocks[block].forEachSetBit([&](uint32_t offset) -> void { action(base + offset); });
+        });
+    }
+};
+
+#endif /* HierarchicalStaticBitVector_hpp */
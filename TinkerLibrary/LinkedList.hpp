@@ -11,6 +11,8 @@
 
 #include <concepts>
 #include <functional>
+#include <iterator>
+#include <type_traits>
 #include "Listable.hpp"
 //#include "Comparable.hpp"
 
@@ -22,11 +24,107 @@ class LinkedList
     // MARK: - Member Types
     //
 
+public:
+    ///
+    /// A bidirectional iterator that visits each node in the list
+    ///
+    /// @tparam IsConstant Pass `true` to visit constant nodes, `false` otherwise.
+    /// @note The iterator stays valid if other nodes are inserted or removed,
+    ///       but it is invalidated if the node it refers to is removed from the list.
+    ///
+    template <bool IsConstant>
+    class Iterator
+    {
+    private:
+        /// The type of the node being visited
+        using Element = std::conditional_t<IsConstant, const Node, Node>;
+
+        /// The current node, `nullptr` if the iterator is past the end of the list
+        Element* current;
+
+        /// The list being iterated, so that the past-the-end iterator can move back to the tail
+        const LinkedList* list;
+
+    public:
+        using value_type = Node;
+        using difference_type = ptrdiff_t;
+        using pointer = Element*;
+        using reference = Element&;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        /// Create an iterator that does not refer to any list
+        Iterator() : current(nullptr), list(nullptr) {}
+
+        /// Create an iterator that refers to the given node in the given list
+        Iterator(Element* current, const LinkedList* list) : current(current), list(list) {}
+
+        /// Convert a mutable iterator to a constant one
+        operator Iterator<true>() const requires (!IsConstant)
+        {
+            return Iterator<true>(this->current, this->list);
+        }
+
+        /// Get the current node
+        inline reference operator*() const
+        {
+            return *this->current;
+        }
+
+        /// Get the current node
+        inline pointer operator->() const
+        {
+            return this->current;
+        }
+
+        /// Advance to the next node
+        inline Iterator& operator++()
+        {
+            this->current = this->current->next;
+
+            return *this;
+        }
+
+        /// Advance to the next node
+        inline Iterator operator++(int)
+        {
+            Iterator current = *this;
+
+            ++(*this);
+
+            return current;
+        }
+
+        /// Move back to the previous node, or to the tail if the iterator is past the end of the list
+        inline Iterator& operator--()
+        {
+            this->current = this->current == nullptr ? this->list->tail : this->current->prev;
+
+            return *this;
+        }
+
+        /// Move back to the previous node, or to the tail if the iterator is past the end of the list
+        inline Iterator operator--(int)
+        {
+            Iterator current = *this;
+
+            --(*this);
+
+            return current;
+        }
+
+        /// Check whether two iterators refer to the same node
+        inline bool operator==(const Iterator& other) const
+        {
+            return this->current == other.current;
+        }
+    };
+
     /// The type of various iterators
-//    using iterator = Node*;
-//    using const_iterator = const Node*;
-//    using reverse_iterator = Node*;
-//    using const_reverse_iterator = const Node*;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
     //
     // MARK: - Metadata
@@ -326,6 +424,230 @@ public:
         node->next = nullptr;
     }
 
+    //
+    // MARK: Bulk Operations
+    //
+
+    ///
+    /// Move all nodes in the given list to the end of this list
+    ///
+    /// @param other Another list whose nodes are appended to this list in order, which becomes empty afterwards
+    /// @note This function runs in O(1) time regardless of the number of nodes being moved.
+    ///
+    void spliceBack(LinkedList& other)
+    {
+        // Guard: The other list has no nodes to move
+        if (other.isEmpty() || &other == this)
+        {
+            return;
+        }
+
+        if (this->isEmpty())
+        {
+            this->head = other.head;
+        }
+        else
+        {
+            this->tail->next = other.head;
+
+            other.head->prev = this->tail;
+        }
+
+        this->tail = other.tail;
+
+        this->count += other.count;
+
+        other.head = nullptr;
+
+        other.tail = nullptr;
+
+        other.count = 0;
+    }
+
+    ///
+    /// Move all nodes in the given list to the end of this list
+    ///
+    /// @param other A temporary list, e.g. the result of `splitAfter()` or `removeRange()`
+    /// @note This function runs in O(1) time regardless of the number of nodes being moved.
+    ///
+    void spliceBack(LinkedList&& other)
+    {
+        this->spliceBack(other);
+    }
+
+    ///
+    /// Move all nodes in the given list to the head of this list
+    ///
+    /// @param other Another list whose nodes are prepended to this list in order, which becomes empty afterwards
+    /// @note This function runs in O(1) time regardless of the number of nodes being moved.
+    ///
+    void spliceFront(LinkedList& other)
+    {
+        // Guard: The other list has no nodes to move
+        if (other.isEmpty() || &other == this)
+        {
+            return;
+        }
+
+        if (this->isEmpty())
+        {
+            this->tail = other.tail;
+        }
+        else
+        {
+            this->head->prev = other.tail;
+
+            other.tail->next = this->head;
+        }
+
+        this->head = other.head;
+
+        this->count += other.count;
+
+        other.head = nullptr;
+
+        other.tail = nullptr;
+
+        other.count = 0;
+    }
+
+    ///
+    /// Move all nodes in the given list to the head of this list
+    ///
+    /// @param other A temporary list, e.g. the result of `splitAfter()` or `removeRange()`
+    /// @note This function runs in O(1) time regardless of the number of nodes being moved.
+    ///
+    void spliceFront(LinkedList&& other)
+    {
+        this->spliceFront(other);
+    }
+
+    ///
+    /// Split the list after the given node
+    ///
+    /// @param node A non-null node in the list, which becomes the tail of this list
+    /// @param length The number of nodes after the given node, which the caller must have tracked
+    /// @return A list of the nodes after the given node in order, which is empty if the given node is the tail.
+    /// @note This function runs in O(1) time, but a wrong length corrupts the count of both lists.
+    ///
+    LinkedList splitAfter(Node* node, size_t length)
+    {
+        LinkedList result;
+
+        // Guard: The node is the list tail
+        if (node->next == nullptr)
+        {
+            return result;
+        }
+
+        result.head = node->next;
+
+        result.tail = this->tail;
+
+        result.count = length;
+
+        result.head->prev = nullptr;
+
+        node->next = nullptr;
+
+        this->tail = node;
+
+        this->count -= length;
+
+        return result;
+    }
+
+    ///
+    /// Split the list after the given node
+    ///
+    /// @param node A non-null node in the list, which becomes the tail of this list
+    /// @return A list of the nodes after the given node in order, which is empty if the given node is the tail.
+    /// @note This function counts the nodes after the given node in O(k) time.
+    ///       Use `splitAfter(node, length)` instead if the number of nodes is known.
+    ///
+    LinkedList splitAfter(Node* node)
+    {
+        size_t length = 0;
+
+        for (Node* current = node->next; current != nullptr; current = current->next)
+        {
+            length += 1;
+        }
+
+        return this->splitAfter(node, length);
+    }
+
+    ///
+    /// Remove a range of consecutive nodes from the list
+    ///
+    /// @param first A non-null node in the list, which is the first node to be removed
+    /// @param last A non-null node in the list, which is the last node to be removed, and is either `first` or a node after it
+    /// @param length The number of nodes in the range `[first, last]`, which the caller must have tracked
+    /// @return A list of the removed nodes in order.
+    /// @note This function runs in O(1) time, but a wrong length corrupts the count of both lists.
+    ///
+    LinkedList removeRange(Node* first, Node* last, size_t length)
+    {
+        Node* prev = first->prev;
+
+        Node* next = last->next;
+
+        if (prev == nullptr)
+        {
+            this->head = next;
+        }
+        else
+        {
+            prev->next = next;
+        }
+
+        if (next == nullptr)
+        {
+            this->tail = prev;
+        }
+        else
+        {
+            next->prev = prev;
+        }
+
+        this->count -= length;
+
+        first->prev = nullptr;
+
+        last->next = nullptr;
+
+        LinkedList result;
+
+        result.head = first;
+
+        result.tail = last;
+
+        result.count = length;
+
+        return result;
+    }
+
+    ///
+    /// Remove a range of consecutive nodes from the list
+    ///
+    /// @param first A non-null node in the list, which is the first node to be removed
+    /// @param last A non-null node in the list, which is the last node to be removed, and is either `first` or a node after it
+    /// @return A list of the removed nodes in order.
+    /// @note This function counts the nodes in the range in O(k) time.
+    ///       Use `removeRange(first, last, length)` instead if the number of nodes is known.
+    ///
+    LinkedList removeRange(Node* first, Node* last)
+    {
+        size_t length = 1;
+
+        for (Node* current = first; current != last; current = current->next)
+        {
+            length += 1;
+        }
+
+        return this->removeRange(first, last, length);
+    }
+
     //
     // MARK: Query Linked List Properties
     //
@@ -464,6 +786,98 @@ public:
 
         return nullptr;
     }
+
+    //
+    // MARK: Iterators
+    //
+
+    ///
+    /// Get an iterator that refers to the head of the list
+    ///
+    /// @return An iterator to the first node, or the past-the-end iterator if the list is empty.
+    ///
+    [[nodiscard]]
+    iterator begin()
+    {
+        return iterator(this->head, this);
+    }
+
+    ///
+    /// Get an iterator that refers to the head of the list
+    ///
+    /// @return An iterator to the first node, or the past-the-end iterator if the list is empty.
+    ///
+    [[nodiscard]]
+    const_iterator begin() const
+    {
+        return const_iterator(this->head, this);
+    }
+
+    ///
+    /// Get the past-the-end iterator of the list
+    ///
+    /// @return An iterator that follows the last node.
+    ///
+    [[nodiscard]]
+    iterator end()
+    {
+        return iterator(nullptr, this);
+    }
+
+    ///
+    /// Get the past-the-end iterator of the list
+    ///
+    /// @return An iterator that follows the last node.
+    ///
+    [[nodiscard]]
+    const_iterator end() const
+    {
+        return const_iterator(nullptr, this);
+    }
+
+    ///
+    /// Get a reverse iterator that refers to the tail of the list
+    ///
+    /// @return A reverse iterator to the last node, or the past-the-end reverse iterator if the list is empty.
+    ///
+    [[nodiscard]]
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(this->end());
+    }
+
+    ///
+    /// Get a reverse iterator that refers to the tail of the list
+    ///
+    /// @return A reverse iterator to the last node, or the past-the-end reverse iterator if the list is empty.
+    ///
+    [[nodiscard]]
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(this->end());
+    }
+
+    ///
+    /// Get the past-the-end reverse iterator of the list
+    ///
+    /// @return A reverse iterator that precedes the first node.
+    ///
+    [[nodiscard]]
+    reverse_iterator rend()
+    {
+        return reverse_iterator(this->begin());
+    }
+
+    ///
+    /// Get the past-the-end reverse iterator of the list
+    ///
+    /// @return A reverse iterator that precedes the first node.
+    ///
+    [[nodiscard]]
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(this->begin());
+    }
 };
 
 #endif /* LinkedList_hpp */
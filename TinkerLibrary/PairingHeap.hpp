@@ -0,0 +1,330 @@
+//
+//  PairingHeap.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef PairingHeap_hpp
+#define PairingHeap_hpp
+
+#include <concepts>
+#include <functional>
+#include <utility>
+#include "Heapable.hpp"
+
+///
+/// An intrusive pairing heap that serves as a priority queue
+///
+/// The heap never allocates memory, since each node embeds its own links, so it is safe to use in interrupt context.
+/// Pushing a node and decreasing its key link it to the root in O(1) time,
+/// while popping or removing a node merges its children in two passes in amortized O(log n) time.
+///
+/// Time Complexity:
+/// - `push()`, `peekMin()`: O(1)
+/// - `decreaseKey()`: O(1) actual, amortized O(log n)
+/// - `popMin()`, `remove()`: Amortized O(log n)
+///
+/// @tparam Node Specify the type of nodes
+/// @tparam Comparator Specify a callable type that returns `true` if the first node is less than the second one
+/// @note Unlike `LinkedList::insert()`, nodes that compare equal are not necessarily popped in their insertion order.
+///
+template <typename Node, typename Comparator = std::less<Node>>
+requires HeapableItem<Node>
+class PairingHeap
+{
+    //
+    // MARK: - Metadata
+    //
+
+private:
+    /// The root node, which is the minimum one
+    Node* root;
+
+    /// The current number of elements
+    size_t count;
+
+    /// The comparator that determines the order
+    Comparator comparator;
+
+    //
+    // MARK: - Private Helpers
+    //
+
+    ///
+    /// Link two trees, so that the root of one tree becomes the leftmost child of the other one
+    ///
+    /// @param lhs The root of a tree, which has no siblings
+    /// @param rhs The root of another tree, which has no siblings
+    /// @return The root of the linked tree, which is `rhs` if it is less than `lhs`, and `lhs` otherwise.
+    ///
+    inline Node* link(Node* lhs, Node* rhs)
+    {
+        if (this->comparator(*rhs, *lhs))
+        {
+            std::swap(lhs, rhs);
+        }
+
+        rhs->leftSiblingOrParent = lhs;
+
+        rhs->rightSibling = lhs->child;
+
+        if (lhs->child != nullptr)
+        {
+            lhs->child->leftSiblingOrParent = rhs;
+        }
+
+        lhs->child = rhs;
+
+        return lhs;
+    }
+
+    ///
+    /// Merge a list of sibling trees into a single tree
+    ///
+    /// @param first The leftmost tree, `nullptr` if the list is empty
+    /// @return The root of the merged tree, `nullptr` if the list is empty.
+    /// @note The first pass links pairs of trees from left to right, and chains the results in reverse order through their right siblings.
+    ///       The second pass links the results from right to left, which bounds the amortized cost to O(log n) without any allocation.
+    ///
+    Node* mergeSiblings(Node* first)
+    {
+        // Guard: The list is empty
+        if (first == nullptr)
+        {
+            return nullptr;
+        }
+
+        // Pass 1: Link each pair of trees from left to right
+        Node* reversed = nullptr;
+
+        while (first != nullptr)
+        {
+            Node* lhs = first;
+
+            Node* rhs = lhs->rightSibling;
+
+            // Guard: The last tree has no partner
+            if (rhs == nullptr)
+            {
+                lhs->rightSibling = reversed;
+
+                reversed = lhs;
+
+                break;
+            }
+
+            first = rhs->rightSibling;
+
+            lhs->rightSibling = nullptr;
+
+            rhs->rightSibling = nullptr;
+
+            Node* pair = this->link(lhs, rhs);
+
+            pair->rightSibling = reversed;
+
+            reversed = pair;
+        }
+
+        // Pass 2: Link the pairs from right to left
+        Node* result = reversed;
+
+        reversed = reversed->rightSibling;
+
+        result->rightSibling = nullptr;
+
+        while (reversed != nullptr)
+        {
+            Node* next = reversed->rightSibling;
+
+            reversed->rightSibling = nullptr;
+
+            result = this->link(reversed, result);
+
+            reversed = next;
+        }
+
+        result->leftSiblingOrParent = nullptr;
+
+        return result;
+    }
+
+    ///
+    /// Detach the given node along with its subtree from its parent and siblings
+    ///
+    /// @param node A non-null node in the heap other than the root
+    ///
+    inline void detach(Node* node)
+    {
+        Node* prev = node->leftSiblingOrParent;
+
+        // The node is either the leftmost child of its parent or the right sibling of another node
+        if (prev->child == node)
+        {
+            prev->child = node->rightSibling;
+        }
+        else
+        {
+            prev->rightSibling = node->rightSibling;
+        }
+
+        if (node->rightSibling != nullptr)
+        {
+            node->rightSibling->leftSiblingOrParent = prev;
+        }
+
+        node->rightSibling = nullptr;
+
+        node->leftSiblingOrParent = nullptr;
+    }
+
+    //
+    // MARK: - Constructor & Destructor
+    //
+
+public:
+    ///
+    /// Create an empty pairing heap
+    ///
+    /// @param comparator A comparator instance to determine the order
+    ///
+    explicit PairingHeap(Comparator comparator = Comparator()) : root(nullptr), count(0), comparator(comparator) {}
+
+    //
+    // MARK: Priority Queue Operations
+    //
+
+    ///
+    /// Insert the given node into the heap
+    ///
+    /// @param node A non-null node that is not in any heap
+    ///
+    void push(Node* node)
+    {
+        node->child = nullptr;
+
+        node->rightSibling = nullptr;
+
+        node->leftSiblingOrParent = nullptr;
+
+        this->root = this->root == nullptr ? node : this->link(this->root, node);
+
+        this->count += 1;
+    }
+
+    ///
+    /// Remove the minimum node from the heap
+    ///
+    /// @return A non-null node if the heap is not empty, `NULL` otherwise.
+    ///
+    Node* popMin()
+    {
+        // Guard: Check whether the heap is empty
+        if (this->isEmpty())
+        {
+            return nullptr;
+        }
+
+        Node* node = this->root;
+
+        this->root = this->mergeSiblings(node->child);
+
+        node->child = nullptr;
+
+        this->count -= 1;
+
+        return node;
+    }
+
+    ///
+    /// Remove the given node from the heap
+    ///
+    /// @param node A non-null node to be removed from the heap
+    /// @note This function assumes that the given node is in the heap.
+    ///
+    void remove(Node* node)
+    {
+        // Guard: The node is the minimum one
+        if (node == this->root)
+        {
+            this->popMin();
+
+            return;
+        }
+
+        this->detach(node);
+
+        // Merge the children of the node, and link them back to the root
+        Node* children = this->mergeSiblings(node->child);
+
+        node->child = nullptr;
+
+        if (children != nullptr)
+        {
+            this->root = this->link(this->root, children);
+        }
+
+        this->count -= 1;
+    }
+
+    ///
+    /// Restore the order after the key of the given node has been decreased
+    ///
+    /// @param node A non-null node in the heap whose key has just been decreased by the caller
+    /// @note The node keeps its subtree, which is still ordered because the key has only decreased.
+    /// @warning Use `remove()` and `push()` instead if the key has been increased.
+    ///
+    void decreaseKey(Node* node)
+    {
+        // Guard: The root is still the minimum one
+        if (node == this->root)
+        {
+            return;
+        }
+
+        this->detach(node);
+
+        this->root = this->link(this->root, node);
+    }
+
+    //
+    // MARK: Query Heap Properties
+    //
+
+    ///
+    /// Peek the minimum node of the heap
+    ///
+    /// @return A constant reference to the current minimum node.
+    ///
+    [[nodiscard]]
+    const Node* peekMin() const
+    {
+        return this->root;
+    }
+
+    ///
+    /// Get the number of nodes in the heap
+    ///
+    /// @return The number nodes in the heap.
+    ///
+    [[nodiscard]]
+    size_t getCount() const
+    {
+        return this->count;
+    }
+
+    ///
+    /// Check whether the heap is empty
+    ///
+    /// @return `true` if the heap is empty, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool isEmpty() const
+    {
+        return this->count == 0;
+    }
+};
+
+#endif /* PairingHeap_hpp */
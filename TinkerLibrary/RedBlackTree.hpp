@@ -0,0 +1,794 @@
+//
+//  RedBlackTree.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef RedBlackTree_hpp
+#define RedBlackTree_hpp
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+#include "TreeNode.hpp"
+
+///
+/// An intrusive red-black tree that keeps its nodes sorted
+///
+/// The tree is an ordered associative container that never allocates memory, since each node embeds its own links.
+/// It replaces a sorted `LinkedList` that is scanned for lookups, e.g. the memory regions of an address space:
+/// Insertions, removals and lookups take O(log n) time, while the minimum and the maximum nodes are cached.
+///
+/// Nodes that compare equal keep their insertion order, which is consistent with `LinkedList::insert()`.
+///
+/// Example:
+///
+/// ```
+/// struct Region: TreeNode<Region>
+/// {
+///     uint64_t start, end;
+///
+///     friend bool operator<(const Region& lhs, const Region& rhs) { return lhs.start < rhs.start; }
+///
+///     friend bool operator<(const Region& lhs, uint64_t rhs) { return lhs.start < rhs; }
+///
+///     friend bool operator<(uint64_t lhs, const Region& rhs) { return lhs < rhs.start; }
+/// };
+///
+/// // Find the region that starts at the given address
+/// Region* region = regions.find(address);
+///
+/// // Find the first region that starts at or after the given address
+/// Region* next = regions.lowerBound(address);
+/// ```
+///
+/// @tparam Node Specify the type of nodes
+/// @tparam Comparator Specify a callable type that returns `true` if the first argument is less than the second one.
+///                    The comparator must accept a node and a key in either order to look up nodes by the key,
+///                    which `std::less<>` does if the node type defines `operator<` for the key.
+///
+template <typename Node, typename Comparator = std::less<>>
+requires TreeNodeItem<Node>
+class RedBlackTree
+{
+    //
+    // MARK: - Metadata
+    //
+
+private:
+    /// The root node
+    Node* root;
+
+    /// The minimum node
+    Node* minimum;
+
+    /// The maximum node
+    Node* maximum;
+
+    /// The current number of elements
+    size_t count;
+
+    /// The comparator that determines the order
+    Comparator comparator;
+
+    //
+    // MARK: - Private Helpers
+    //
+
+    ///
+    /// Check whether the given node is black
+    ///
+    /// @param node A node, or `nullptr` to refer to a leaf, which is black
+    /// @return `true` if the node is black, `false` otherwise.
+    ///
+    static inline bool isBlack(const Node* node)
+    {
+        return node == nullptr || !node->isRed;
+    }
+
+    ///
+    /// Get the leftmost node in the given subtree
+    ///
+    /// @param node The non-null root of a subtree
+    /// @return The minimum node in the subtree.
+    ///
+    static inline Node* getLeftmost(Node* node)
+    {
+        while (node->leftChild != nullptr)
+        {
+            node = node->leftChild;
+        }
+
+        return node;
+    }
+
+    ///
+    /// Get the rightmost node in the given subtree
+    ///
+    /// @param node The non-null root of a subtree
+    /// @return The maximum node in the subtree.
+    ///
+    static inline Node* getRightmost(Node* node)
+    {
+        while (node->rightChild != nullptr)
+        {
+            node = node->rightChild;
+        }
+
+        return node;
+    }
+
+    ///
+    /// Replace the given subtree with another subtree in the parent of the former one
+    ///
+    /// @param oldNode The non-null root of the subtree to be replaced
+    /// @param newNode The root of the new subtree, `nullptr` if the subtree is empty
+    /// @note This function does not modify the children of either node.
+    ///
+    inline void replace(Node* oldNode, Node* newNode)
+    {
+        Node* parent = oldNode->parent;
+
+        if (parent == nullptr)
+        {
+            this->root = newNode;
+        }
+        else if (parent->leftChild == oldNode)
+        {
+            parent->leftChild = newNode;
+        }
+        else
+        {
+            parent->rightChild = newNode;
+        }
+
+        if (newNode != nullptr)
+        {
+            newNode->parent = parent;
+        }
+    }
+
+    ///
+    /// Rotate the given subtree to the left, so that the right child becomes its root
+    ///
+    /// @param node The non-null root of the subtree, which has a non-null right child
+    ///
+    void rotateLeft(Node* node)
+    {
+        Node* child = node->rightChild;
+
+        node->rightChild = child->leftChild;
+
+        if (child->leftChild != nullptr)
+        {
+            child->leftChild->parent = node;
+        }
+
+        this->replace(node, child);
+
+        child->leftChild = node;
+
+        node->parent = child;
+    }
+
+    ///
+    /// Rotate the given subtree to the right, so that the left child becomes its root
+    ///
+    /// @param node The non-null root of the subtree, which has a non-null left child
+    ///
+    void rotateRight(Node* node)
+    {
+        Node* child = node->leftChild;
+
+        node->leftChild = child->rightChild;
+
+        if (child->rightChild != nullptr)
+        {
+            child->rightChild->parent = node;
+        }
+
+        this->replace(node, child);
+
+        child->rightChild = node;
+
+        node->parent = child;
+    }
+
+    ///
+    /// Restore the red-black properties after inserting the given red node
+    ///
+    /// @param node The non-null node that has just been inserted
+    ///
+    void fixAfterInsertion(Node* node)
+    {
+        // Two red nodes in a row violate the properties
+        for (Node* parent = node->parent; parent != nullptr && parent->isRed; parent = node->parent)
+        {
+            // The parent is red, so it is not the root and the grandparent exists
+            Node* grandparent = parent->parent;
+
+            if (parent == grandparent->leftChild)
+            {
+                Node* uncle = grandparent->rightChild;
+
+                // Case 1: The uncle is red, so push the blackness of the grandparent down, and continue from the grandparent
+                if (!isBlack(uncle))
+                {
+                    parent->isRed = false;
+
+                    uncle->isRed = false;
+
+                    grandparent->isRed = true;
+
+                    node = grandparent;
+
+                    continue;
+                }
+
+                // Case 2: The node is an inner child, so rotate it to the outside
+                if (node == parent->rightChild)
+                {
+                    this->rotateLeft(parent);
+
+                    parent = node;
+                }
+
+                // Case 3: The node is an outer child, so rotate the grandparent to the other side
+                parent->isRed = false;
+
+                grandparent->isRed = true;
+
+                this->rotateRight(grandparent);
+
+                break;
+            }
+            else
+            {
+                Node* uncle = grandparent->leftChild;
+
+                if (!isBlack(uncle))
+                {
+                    parent->isRed = false;
+
+                    uncle->isRed = false;
+
+                    grandparent->isRed = true;
+
+                    node = grandparent;
+
+                    continue;
+                }
+
+                if (node == parent->leftChild)
+                {
+                    this->rotateRight(parent);
+
+                    parent = node;
+                }
+
+                parent->isRed = false;
+
+                grandparent->isRed = true;
+
+                this->rotateLeft(grandparent);
+
+                break;
+            }
+        }
+
+        this->root->isRed = false;
+    }
+
+    ///
+    /// Restore the red-black properties after removing a black node
+    ///
+    /// @param node The node that took the place of the removed node, `nullptr` if it is a leaf
+    /// @param parent The parent of `node`, `nullptr` if `node` is the root
+    /// @note The subtree rooted at `node` has one fewer black node on each path than its sibling.
+    ///
+    void fixAfterRemoval(Node* node, Node* parent)
+    {
+        while (node != this->root && isBlack(node))
+        {
+            // The node has a sibling, because the subtree of the sibling has at least one black node
+            if (node == parent->leftChild)
+            {
+                Node* sibling = parent->rightChild;
+
+                // Case 1: The sibling is red, so rotate the parent to make the sibling black
+                if (sibling->isRed)
+                {
+                    sibling->isRed = false;
+
+                    parent->isRed = true;
+
+                    this->rotateLeft(parent);
+
+                    sibling = parent->rightChild;
+                }
+
+                // Case 2: Both children of the sibling are black, so move the missing black node up to the parent
+                if (isBlack(sibling->leftChild) && isBlack(sibling->rightChild))
+                {
+                    sibling->isRed = true;
+
+                    node = parent;
+
+                    parent = node->parent;
+
+                    continue;
+                }
+
+                // Case 3: The outer child of the sibling is black, so rotate the red inner child to the outside
+                if (isBlack(sibling->rightChild))
+                {
+                    sibling->leftChild->isRed = false;
+
+                    sibling->isRed = true;
+
+                    this->rotateRight(sibling);
+
+                    sibling = parent->rightChild;
+                }
+
+                // Case 4: The outer child of the sibling is red, so rotate the parent to move a black node to this side
+                sibling->isRed = parent->isRed;
+
+                parent->isRed = false;
+
+                sibling->rightChild->isRed = false;
+
+                this->rotateLeft(parent);
+
+                node = this->root;
+            }
+            else
+            {
+                Node* sibling = parent->leftChild;
+
+                if (sibling->isRed)
+                {
+                    sibling->isRed = false;
+
+                    parent->isRed = true;
+
+                    this->rotateRight(parent);
+
+                    sibling = parent->leftChild;
+                }
+
+                if (isBlack(sibling->leftChild) && isBlack(sibling->rightChild))
+                {
+                    sibling->isRed = true;
+
+                    node = parent;
+
+                    parent = node->parent;
+
+                    continue;
+                }
+
+                if (isBlack(sibling->leftChild))
+                {
+                    sibling->rightChild->isRed = false;
+
+                    sibling->isRed = true;
+
+                    this->rotateLeft(sibling);
+
+                    sibling = parent->leftChild;
+                }
+
+                sibling->isRed = parent->isRed;
+
+                parent->isRed = false;
+
+                sibling->leftChild->isRed = false;
+
+                this->rotateRight(parent);
+
+                node = this->root;
+            }
+        }
+
+        if (node != nullptr)
+        {
+            node->isRed = false;
+        }
+    }
+
+    //
+    // MARK: - Constructor & Destructor
+    //
+
+public:
+    ///
+    /// Create an empty red-black tree
+    ///
+    /// @param comparator A comparator instance to determine the order
+    ///
+    explicit RedBlackTree(Comparator comparator = Comparator()) : root(nullptr), minimum(nullptr), maximum(nullptr), count(0), comparator(comparator) {}
+
+    //
+    // MARK: Tree Operations
+    //
+
+    ///
+    /// Insert the given node in the order determined by the comparator
+    ///
+    /// @param node A non-null node that is not in any tree
+    /// @note The node is inserted after the nodes that compare equal to it.
+    ///
+    void insert(Node* node)
+    {
+        Node* parent = nullptr;
+
+        bool isLeftChild = false, isMinimum = true, isMaximum = true;
+
+        // Nodes that compare equal go to the right
+        for (Node* current = this->root; current != nullptr; current = isLeftChild ? current->leftChild : current->rightChild)
+        {
+            parent = current;
+
+            isLeftChild = this->comparator(*node, *current);
+
+            isMinimum &= isLeftChild;
+
+            isMaximum &= !isLeftChild;
+        }
+
+        node->parent = parent;
+
+        node->leftChild = nullptr;
+
+        node->rightChild = nullptr;
+
+        node->isRed = true;
+
+        if (parent == nullptr)
+        {
+            this->root = node;
+        }
+        else if (isLeftChild)
+        {
+            parent->leftChild = node;
+        }
+        else
+        {
+            parent->rightChild = node;
+        }
+
+        // The node is the minimum if the search always went left, and the maximum if it always went right
+        if (isMinimum)
+        {
+            this->minimum = node;
+        }
+
+        if (isMaximum)
+        {
+            this->maximum = node;
+        }
+
+        this->fixAfterInsertion(node);
+
+        this->count += 1;
+    }
+
+    ///
+    /// Remove the given node from the tree
+    ///
+    /// @param node A non-null node to be removed from the tree
+    /// @note This function assumes that the given node is in the tree.
+    ///
+    void remove(Node* node)
+    {
+        if (node == this->minimum)
+        {
+            this->minimum = RedBlackTree::findNext(node);
+        }
+
+        if (node == this->maximum)
+        {
+            this->maximum = RedBlackTree::findPrev(node);
+        }
+
+        // The node that takes the place of the removed black node, along with its parent
+        Node* child = nullptr;
+
+        Node* parent = nullptr;
+
+        bool isRemovedBlack = false;
+
+        // Case 1: The node has at most one child, which takes its place
+        if (node->leftChild == nullptr || node->rightChild == nullptr)
+        {
+            child = node->leftChild != nullptr ? node->leftChild : node->rightChild;
+
+            parent = node->parent;
+
+            isRemovedBlack = !node->isRed;
+
+            this->replace(node, child);
+        }
+        // Case 2: The node has two children, so its successor takes its place and color
+        else
+        {
+            Node* successor = getLeftmost(node->rightChild);
+
+            child = successor->rightChild;
+
+            isRemovedBlack = !successor->isRed;
+
+            if (successor->parent == node)
+            {
+                parent = successor;
+            }
+            else
+            {
+                parent = successor->parent;
+
+                this->replace(successor, child);
+
+                successor->rightChild = node->rightChild;
+
+                successor->rightChild->parent = successor;
+            }
+
+            this->replace(node, successor);
+
+            successor->leftChild = node->leftChild;
+
+            successor->leftChild->parent = successor;
+
+            successor->isRed = node->isRed;
+        }
+
+        if (isRemovedBlack)
+        {
+            this->fixAfterRemoval(child, parent);
+        }
+
+        node->parent = nullptr;
+
+        node->leftChild = nullptr;
+
+        node->rightChild = nullptr;
+
+        node->isRed = false;
+
+        this->count -= 1;
+    }
+
+    //
+    // MARK: Lookup Operations
+    //
+
+    ///
+    /// Find the first node that is not less than the given key
+    ///
+    /// @param key A node or a key that the comparator accepts
+    /// @return The first node that is not less than the key, `nullptr` if all nodes are less than the key.
+    ///
+    template <typename Key>
+    [[nodiscard]]
+    Node* lowerBound(const Key& key) const
+    {
+        Node* result = nullptr;
+
+        for (Node* current = this->root; current != nullptr;)
+        {
+            if (this->comparator(*current, key))
+            {
+                current = current->rightChild;
+            }
+            else
+            {
+                result = current;
+
+                current = current->leftChild;
+            }
+        }
+
+        return result;
+    }
+
+    ///
+    /// Find the first node that is greater than the given key
+    ///
+    /// @param key A node or a key that the comparator accepts
+    /// @return The first node that is greater than the key, `nullptr` if no node is greater than the key.
+    ///
+    template <typename Key>
+    [[nodiscard]]
+    Node* upperBound(const Key& key) const
+    {
+        Node* result = nullptr;
+
+        for (Node* current = this->root; current != nullptr;)
+        {
+            if (this->comparator(key, *current))
+            {
+                result = current;
+
+                current = current->leftChild;
+            }
+            else
+            {
+                current = current->rightChild;
+            }
+        }
+
+        return result;
+    }
+
+    ///
+    /// Find the first node that is equal to the given key
+    ///
+    /// @param key A node or a key that the comparator accepts
+    /// @return The first node that is neither less nor greater than the key, `nullptr` if not found such node.
+    /// @note The returned node is still in the tree.
+    ///
+    template <typename Key>
+    [[nodiscard]]
+    Node* find(const Key& key) const
+    {
+        Node* node = this->lowerBound(key);
+
+        return node != nullptr && !this->comparator(key, *node) ? node : nullptr;
+    }
+
+    ///
+    /// Find the next node of the given node in order
+    ///
+    /// @param node A non-null node in a tree, or `nullptr`
+    /// @return The next node, `nullptr` if the given node is the maximum one or `nullptr`.
+    ///
+    template <typename Item>
+    requires std::same_as<std::remove_const_t<Item>, Node>
+    static Item* findNext(Item* node)
+    {
+        // Guard: The node is null
+        if (node == nullptr)
+        {
+            return nullptr;
+        }
+
+        // The leftmost node in the right subtree
+        if (node->rightChild != nullptr)
+        {
+            return getLeftmost(node->rightChild);
+        }
+
+        // The first ancestor whose left subtree contains the node
+        while (node->parent != nullptr && node == node->parent->rightChild)
+        {
+            node = node->parent;
+        }
+
+        return node->parent;
+    }
+
+    ///
+    /// Find the previous node of the given node in order
+    ///
+    /// @param node A non-null node in a tree, or `nullptr`
+    /// @return The previous node, `nullptr` if the given node is the minimum one or `nullptr`.
+    ///
+    template <typename Item>
+    requires std::same_as<std::remove_const_t<Item>, Node>
+    static Item* findPrev(Item* node)
+    {
+        // Guard: The node is null
+        if (node == nullptr)
+        {
+            return nullptr;
+        }
+
+        // The rightmost node in the left subtree
+        if (node->leftChild != nullptr)
+        {
+            return getRightmost(node->leftChild);
+        }
+
+        // The first ancestor whose right subtree contains the node
+        while (node->parent != nullptr && node == node->parent->leftChild)
+        {
+            node = node->parent;
+        }
+
+        return node->parent;
+    }
+
+    //
+    // MARK: Query Tree Properties
+    //
+
+    ///
+    /// Peek the minimum node of the tree
+    ///
+    /// @return A constant reference to the current minimum node.
+    ///
+    [[nodiscard]]
+    const Node* peekMin() const
+    {
+        return this->minimum;
+    }
+
+    ///
+    /// Peek the maximum node of the tree
+    ///
+    /// @return A constant reference to the current maximum node.
+    ///
+    [[nodiscard]]
+    const Node* peekMax() const
+    {
+        return this->maximum;
+    }
+
+    ///
+    /// Peek the root node of the tree
+    ///
+    /// @return A constant reference to the current root node.
+    ///
+    [[nodiscard]]
+    const Node* peekRoot() const
+    {
+        return this->root;
+    }
+
+    ///
+    /// Get the number of nodes in the tree
+    ///
+    /// @return The number nodes in the tree.
+    ///
+    [[nodiscard]]
+    size_t getCount() const
+    {
+        return this->count;
+    }
+
+    ///
+    /// Check whether the tree is empty
+    ///
+    /// @return `true` if the tree is empty, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool isEmpty() const
+    {
+        return this->count == 0;
+    }
+
+    ///
+    /// Call the given action on each element in order
+    ///
+    /// @param action A functor that takes a constant reference to each element in the tree
+    ///
+    template <typename Action>
+    requires std::invocable<Action, const Node*> && std::same_as<std::invoke_result_t<Action, const Node*>, void>
+    void forEach(Action action) const
+    {
+        for (const Node* current = this->minimum; current != nullptr; current = RedBlackTree::findNext(current))
+        {
+            action(current);
+        }
+    }
+
+    ///
+    /// Call the given action on each element in reverse order
+    ///
+    /// @param action A functor that takes a constant reference to each element in the tree
+    ///
+    template <typename Action>
+    requires std::invocable<Action, const Node*> && std::same_as<std::invoke_result_t<Action, const Node*>, void>
+    void reverseForEach(Action action) const
+    {
+        for (const Node* current = this->maximum; current != nullptr; current = RedBlackTree::findPrev(current))
+        {
+            action(current);
+        }
+    }
+};
+
+#endif /* RedBlackTree_hpp */
@@ -13,31 +13,79 @@
 #include <cstddef>
 #include <concepts>
 #include "Debug.hpp"
+#include "WideUnsignedInteger.hpp"
 
-static constexpr uint8_t MultiplyDeBruijnBitPosition32[32] =
+//
+// MARK: - Backend Selection
+//
+// `LSBFinder` and `MSBFinder` use the compiler intrinsics that map to a single instruction
+// (e.g. `bsf`/`tzcnt` and `bsr`/`lzcnt` on x86, `rbit`+`clz` and `clz` on ARM) when they are available,
+// and fall back to the portable implementation based on de Bruijn sequences and binary search otherwise.
+// Define `SIGNIFICANT_BIT_PORTABLE` to always use the portable implementation, e.g. in a freestanding build whose compiler lacks these intrinsics.
+// Integers wider than 64 bits (e.g. `UInt128` and `UInt256`) are examined one 64-bit word at a time with the same backend.
+//
+#if defined(SIGNIFICANT_BIT_PORTABLE)
+    // Use the portable implementation
+#elif defined(__GNUC__) || defined(__clang__)
+    #define SIGNIFICANT_BIT_BUILTINS 1
+#elif __has_include(<bit>)
+    #include <bit>
+    #define SIGNIFICANT_BIT_STD 1
+#endif
+
+///
+/// A table that maps the high bits of a de Bruijn sequence shifted to the left by `i` back to `i`
+///
+/// Multiplying a power of 2 by the sequence is the same as shifting the sequence,
+/// and the high `log2(N)` bits of the product are unique for each shift, so they index the table.
+/// The table is generated at compile time from the sequence, so it is a constant in the read-only data section as the hand-written one.
+///
+/// @tparam T Specify the integer type, whose width is the number of entries
+/// @tparam Sequence Specify the de Bruijn sequence for the integer width
+///
+template <typename T, T Sequence>
+requires std::unsigned_integral<T> && (sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(uint64_t))
+struct DeBruijnBitPositionTable
+{
+    /// Compile time constant that stores the number of entries
+    static constexpr size_t NumEntries = sizeof(T) * 8;
+
+    /// Compile time constant that stores the amount to shift a product to the right to get an index, i.e. `N - log2(N)`
+    static constexpr size_t Shift = NumEntries - (NumEntries == 64 ? 6 : 5);
+
+    /// The bit position of each index
+    uint8_t positions[NumEntries];
+
+    /// Generate the table
+    consteval DeBruijnBitPositionTable() : positions{}
+    {
+        for (size_t index = 0; index < NumEntries; index += 1)
         {
-                0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
-                31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
-        };
+            this->positions[static_cast<T>(Sequence << index) >> Shift] = static_cast<uint8_t>(index);
+        }
+    }
+
+    /// Get the bit position at the given index
+    constexpr uint8_t operator[](size_t index) const
+    {
+        return this->positions[index];
+    }
+};
+
+static constexpr DeBruijnBitPositionTable<uint32_t, 0x077CB531> MultiplyDeBruijnBitPosition32;
 
 // https://stackoverflow.com/questions/31374628/fast-way-of-finding-most-and-least-significant-bit-set-in-a-64-bit-integer
-static constexpr uint8_t MultiplyDeBruijnBitPosition64[64] =
-        {
-                0,   1, 17,  2, 18, 50,  3, 57,
-                47, 19, 22, 51, 29,  4, 33, 58,
-                15, 48, 20, 27, 25, 23, 52, 41,
-                54, 30, 38,  5, 43, 34, 59,  8,
-                63, 16, 49, 56, 46, 21, 28, 32,
-                14, 26, 24, 40, 53, 37, 42,  7,
-                62, 55, 45, 31, 13, 39, 36,  6,
-                61, 44, 12, 35, 60, 11, 10,  9,
-        };
-
-/// Private functor to find the LSB index of a fixed width integer
+static constexpr DeBruijnBitPositionTable<uint64_t, 0x37E84A99DAE458F> MultiplyDeBruijnBitPosition64;
+
+//
+// MARK: - Portable Implementation
+//
+
+/// Private functor to find the LSB index of a fixed width integer without compiler intrinsics
 /// @note The integer value must not be 0, otherwise the functor returns 0.
 template <typename T = size_t, size_t IntegerWidth = sizeof(T)>
 requires std::unsigned_integral<T>
-struct LSBFinder
+struct PortableLSBFinder
 {
     uint32_t operator()(T value)
     {
@@ -45,11 +93,11 @@ struct LSBFinder
     }
 };
 
-/// LSBFinder: Specialized for 8-bit integer
+/// PortableLSBFinder: Specialized for 8-bit integer
 template <typename T>
-struct LSBFinder<T, 1>
+struct PortableLSBFinder<T, 1>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         if (value == 0)
         {
@@ -70,11 +118,11 @@ struct LSBFinder<T, 1>
     }
 };
 
-/// LSBFinder: Specialized for 16-bit integer
+/// PortableLSBFinder: Specialized for 16-bit integer
 template <typename T>
-struct LSBFinder<T, 2>
+struct PortableLSBFinder<T, 2>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         if (value == 0)
         {
@@ -120,31 +168,31 @@ struct LSBFinder<T, 2>
     }
 };
 
-/// LSBFinder: Specialized for 32-bit integer
+/// PortableLSBFinder: Specialized for 32-bit integer
 template <typename T>
-struct LSBFinder<T, 4>
+struct PortableLSBFinder<T, 4>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         return MultiplyDeBruijnBitPosition32[((value & -value) * 0x077CB531) >> 27];
     }
 };
 
-/// LSBFinder: Specialized for 64-bit integer
+/// PortableLSBFinder: Specialized for 64-bit integer
 template <typename T>
-struct LSBFinder<T, 8>
+struct PortableLSBFinder<T, 8>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         return MultiplyDeBruijnBitPosition64[((value & -value) * 0x37E84A99DAE458F) >> 58];
     }
 };
 
-/// Private functor to find the MSB index of a fixed width integer
+/// Private functor to find the MSB index of a fixed width integer without compiler intrinsics
 /// @note The integer value must not be 0, otherwise the functor returns 0.
 template <typename T = size_t, size_t IntegerWidth = sizeof(T)>
 requires std::unsigned_integral<T>
-struct MSBFinder
+struct PortableMSBFinder
 {
     uint32_t operator()(T value)
     {
@@ -152,11 +200,11 @@ struct MSBFinder
     }
 };
 
-/// MSBFinder: Specialized for 8-bit integer
+/// PortableMSBFinder: Specialized for 8-bit integer
 template <typename T>
-struct MSBFinder<T, 1>
+struct PortableMSBFinder<T, 1>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         // Linear Search
         uint32_t count = 0;
@@ -170,11 +218,11 @@ struct MSBFinder<T, 1>
     }
 };
 
-/// MSBFinder: Specialized for 16-bit integer
+/// PortableMSBFinder: Specialized for 16-bit integer
 template <typename T>
-struct MSBFinder<T, 2>
+struct PortableMSBFinder<T, 2>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         // Binary Search
         uint32_t count = 0;
@@ -215,11 +263,11 @@ struct MSBFinder<T, 2>
     }
 };
 
-/// MSBFinder: Specialized for 32-bit integer
+/// PortableMSBFinder: Specialized for 32-bit integer
 template <typename T>
-struct MSBFinder<T, 4>
+struct PortableMSBFinder<T, 4>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         value |= value >> 1;
         value |= value >> 2;
@@ -232,11 +280,11 @@ struct MSBFinder<T, 4>
     }
 };
 
-/// MSBFinder: Specialized for 64-bit integer
+/// PortableMSBFinder: Specialized for 64-bit integer
 template <typename T>
-struct MSBFinder<T, 8>
+struct PortableMSBFinder<T, 8>
 {
-    uint32_t operator()(T value)
+    constexpr uint32_t operator()(T value)
     {
         value |= value >> 1;
         value |= value >> 2;
@@ -250,12 +298,228 @@ struct MSBFinder<T, 8>
     }
 };
 
-/// Round a number up to the next highest power of 2
+//
+// MARK: - Intrinsic Implementation
+//
+
+#if defined(SIGNIFICANT_BIT_BUILTINS) || defined(SIGNIFICANT_BIT_STD)
+/// Private functor to find the LSB index of an integer with compiler intrinsics
+/// @note The integer value must not be 0, otherwise the functor returns 0.
 template <typename T = size_t>
 requires std::unsigned_integral<T>
+struct IntrinsicLSBFinder
+{
+    constexpr uint32_t operator()(T value)
+    {
+        static_assert(sizeof(T) <= sizeof(unsigned long long), "Unsupported Integer Width.");
+
+        // Guard: The result of the instruction is undefined or equal to the integer width if no bit is set
+        if (value == 0)
+        {
+            return 0;
+        }
+
+#if defined(SIGNIFICANT_BIT_BUILTINS)
+        if constexpr (sizeof(T) <= sizeof(unsigned int))
+        {
+            return __builtin_ctz(value);
+        }
+        else
+        {
+            return __builtin_ctzll(value);
+        }
+#else
+        return std::countr_zero(value);
+#endif
+    }
+};
+
+/// Private functor to find the MSB index of an integer with compiler intrinsics
+/// @note The integer value must not be 0, otherwise the functor returns 0.
+template <typename T = size_t>
+requires std::unsigned_integral<T>
+struct IntrinsicMSBFinder
+{
+    constexpr uint32_t operator()(T value)
+    {
+        static_assert(sizeof(T) <= sizeof(unsigned long long), "Unsupported Integer Width.");
+
+        // Setting the lowest bit does not change the MSB of a non-zero value,
+        // but yields 0 for zero without a branch, because the result of the instruction is undefined if no bit is set.
+#if defined(SIGNIFICANT_BIT_BUILTINS)
+        if constexpr (sizeof(T) <= sizeof(unsigned int))
+        {
+            return sizeof(unsigned int) * 8 - 1 - __builtin_clz(value | 1u);
+        }
+        else
+        {
+            return sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(value | 1u);
+        }
+#else
+        return std::bit_width(static_cast<T>(value | 1u)) - 1;
+#endif
+    }
+};
+#endif
+
+//
+// MARK: - Wide Integer Implementation
+//
+
+/// Private functor to find the LSB index of an integer wider than 64 bits
+/// @note The integer value must not be 0, otherwise the functor returns 0.
+template <typename T>
+requires WideUnsignedIntegral<T>
+struct WideLSBFinder;
+
+/// Private functor to find the MSB index of an integer wider than 64 bits
+/// @note The integer value must not be 0, otherwise the functor returns 0.
+template <typename T>
+requires WideUnsignedIntegral<T>
+struct WideMSBFinder;
+
+//
+// MARK: - Finders
+//
+
+/// Functor to find the LSB index of a fixed width integer
+/// @note The integer value must not be 0, otherwise the functor returns 0.
+/// @note This functor uses the compiler intrinsics if available, and the portable implementation otherwise.
+template <typename T = size_t, size_t IntegerWidth = sizeof(T)>
+requires ExtendedUnsignedIntegral<T>
+struct LSBFinder
+{
+    constexpr uint32_t operator()(T value)
+    {
+        if constexpr (IntegerWidth > sizeof(uint64_t))
+        {
+            return WideLSBFinder<T>()(value);
+        }
+        else
+        {
+#if defined(SIGNIFICANT_BIT_BUILTINS) || defined(SIGNIFICANT_BIT_STD)
+            return IntrinsicLSBFinder<T>()(value);
+#else
+            return PortableLSBFinder<T, IntegerWidth>()(value);
+#endif
+        }
+    }
+};
+
+/// Functor to find the MSB index of a fixed width integer
+/// @note The integer value must not be 0, otherwise the functor returns 0.
+/// @note This functor uses the compiler intrinsics if available, and the portable implementation otherwise.
+template <typename T = size_t, size_t IntegerWidth = sizeof(T)>
+requires ExtendedUnsignedIntegral<T>
+struct MSBFinder
+{
+    constexpr uint32_t operator()(T value)
+    {
+        if constexpr (IntegerWidth > sizeof(uint64_t))
+        {
+            return WideMSBFinder<T>()(value);
+        }
+        else
+        {
+#if defined(SIGNIFICANT_BIT_BUILTINS) || defined(SIGNIFICANT_BIT_STD)
+            return IntrinsicMSBFinder<T>()(value);
+#else
+            return PortableMSBFinder<T, IntegerWidth>()(value);
+#endif
+        }
+    }
+};
+
+/// Functor to count the number of set bits in an integer
+/// @note This functor uses the `popcnt` instruction if the target supports it,
+///       and the SWAR algorithm that adds up bit counts in parallel within the integer otherwise.
+template <typename T = size_t>
+requires ExtendedUnsignedIntegral<T>
+struct PopulationCounter
+{
+    constexpr uint32_t operator()(T value)
+    {
+        // Wide integers: Sum up the count of each 64-bit word
+        if constexpr (sizeof(T) > sizeof(uint64_t))
+        {
+            // The sum is kept in 64 bits, because GCC 12 miscompiles a 32-bit sum of the SWAR counts below when it vectorizes the sum with AVX-512
+            uint64_t count = 0;
+
+            for (size_t index = 0; index < sizeof(T) / sizeof(uint64_t); index += 1)
+            {
+                count += PopulationCounter<uint64_t>()(getWideIntegerWord(value, index));
+            }
+
+            return static_cast<uint32_t>(count);
+        }
+        else
+        {
+#if defined(SIGNIFICANT_BIT_BUILTINS) && defined(__POPCNT__)
+            // A single `popcnt` instruction
+            return __builtin_popcountll(value);
+#else
+            uint64_t bits = value;
+
+            // Count bits in each 2-bit, 4-bit and 8-bit field
+            bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+            bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+            bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+            // Sum up all 8-bit fields in the high byte
+            return static_cast<uint32_t>((bits * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+    }
+};
+
+template <typename T>
+requires WideUnsignedIntegral<T>
+struct WideLSBFinder
+{
+    constexpr uint32_t operator()(T value)
+    {
+        // Examine each 64-bit word from the least significant one
+        for (size_t index = 0; index < sizeof(T) / sizeof(uint64_t); index += 1)
+        {
+            uint64_t word = getWideIntegerWord(value, index);
+
+            if (word != 0)
+            {
+                return static_cast<uint32_t>(index * 64) + LSBFinder<uint64_t>()(word);
+            }
+        }
+
+        return 0;
+    }
+};
+
+template <typename T>
+requires WideUnsignedIntegral<T>
+struct WideMSBFinder
+{
+    constexpr uint32_t operator()(T value)
+    {
+        // Examine each 64-bit word from the most significant one
+        for (size_t index = sizeof(T) / sizeof(uint64_t); index-- > 0;)
+        {
+            uint64_t word = getWideIntegerWord(value, index);
+
+            if (word != 0)
+            {
+                return static_cast<uint32_t>(index * 64) + MSBFinder<uint64_t>()(word);
+            }
+        }
+
+        return 0;
+    }
+};
+
+/// Round a number up to the next highest power of 2
+template <typename T = size_t>
+requires ExtendedUnsignedIntegral<T>
 struct NextPowerOf2Finder
 {
-    T operator()(T value)
+    constexpr T operator()(T value)
     {
         return value == 1 ? 1 : static_cast<T>(1) << (MSBFinder<T>()(value - 1) + 1);
     }
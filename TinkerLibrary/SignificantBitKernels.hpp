@@ -0,0 +1,262 @@
+//
+//  SignificantBitKernels.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef SignificantBitKernels_hpp
+#define SignificantBitKernels_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include "SignificantBit.hpp"
+
+//
+// MARK: - Instruction Set Selection
+//
+// Kernels are selected at compile time by the target instruction set.
+// AVX-512 kernels count leading zeros of 16 32-bit or 8 64-bit integers with a single `vplzcnt` instruction.
+// AVX2 has no such instruction, so AVX2 kernels convert 8 32-bit integers to floats and read their exponents instead.
+// Other integer widths and targets use the scalar finders, which compile to a single instruction per integer on most targets.
+//
+#if defined(__AVX512F__) && defined(__AVX512CD__)
+    #include <immintrin.h>
+    #define SIGNIFICANT_BIT_KERNELS_AVX512 1
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+    #define SIGNIFICANT_BIT_KERNELS_AVX2 1
+#endif
+
+//
+// MARK: - Operations
+//
+// Each operation provides `apply()` for a single integer, `apply32()` for a register of 32-bit integers,
+// and `apply64()` for a register of 64-bit integers if the target instruction set supports it.
+// Vector overloads produce the same results as the scalar one, including 0 for the LSB and the MSB of zero.
+//
+
+/// Find the LSB index of an integer
+struct LeastSignificantBitOperation
+{
+    template <typename T>
+    requires std::unsigned_integral<T>
+    static inline uint32_t apply(T value) { return LSBFinder<T>()(value); }
+
+#if defined(SIGNIFICANT_BIT_KERNELS_AVX512)
+    static inline __m512i apply32(__m512i values)
+    {
+        // Isolate the lowest set bit, whose index is 31 - lzcnt, and clamp the index of zero from -1 to 0
+        __m512i lowest = _mm512_and_si512(values, _mm512_sub_epi32(_mm512_setzero_si512(), values));
+
+        return _mm512_max_epi32(_mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(lowest)), _mm512_setzero_si512());
+    }
+
+    static inline __m512i apply64(__m512i values)
+    {
+        __m512i lowest = _mm512_and_si512(values, _mm512_sub_epi64(_mm512_setzero_si512(), values));
+
+        return _mm512_max_epi64(_mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(lowest)), _mm512_setzero_si512());
+    }
+#elif defined(SIGNIFICANT_BIT_KERNELS_AVX2)
+    static inline __m256i apply32(__m256i values)
+    {
+        // Isolate the lowest set bit, which is a power of 2 and thus converts to a float exactly
+        __m256i lowest = _mm256_and_si256(values, _mm256_sub_epi32(_mm256_setzero_si256(), values));
+
+        // The conversion is signed, so 2^31 becomes -2^31, whose sign bit is masked out along with the mantissa
+        __m256i exponents = _mm256_and_si256(_mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(lowest)), 23), _mm256_set1_epi32(0xFF));
+
+        // Remove the bias, and clamp the index of zero from -127 to 0
+        return _mm256_max_epi32(_mm256_sub_epi32(exponents, _mm256_set1_epi32(127)), _mm256_setzero_si256());
+    }
+#endif
+};
+
+/// Find the MSB index of an integer
+struct MostSignificantBitOperation
+{
+    template <typename T>
+    requires std::unsigned_integral<T>
+    static inline uint32_t apply(T value) { return MSBFinder<T>()(value); }
+
+#if defined(SIGNIFICANT_BIT_KERNELS_AVX512)
+    static inline __m512i apply32(__m512i values)
+    {
+        // Setting the lowest bit yields 0 for zero
+        return _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(_mm512_or_si512(values, _mm512_set1_epi32(1))));
+    }
+
+    static inline __m512i apply64(__m512i values)
+    {
+        return _mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(_mm512_or_si512(values, _mm512_set1_epi64(1))));
+    }
+#elif defined(SIGNIFICANT_BIT_KERNELS_AVX2)
+    static inline __m256i apply32(__m256i values)
+    {
+        // A float has 24 significant bits, so larger integers might be rounded up to the next power of 2.
+        // Convert their high 24 bits instead, and add the shift amount back to the exponent.
+        __m256i isLarge = _mm256_cmpgt_epi32(_mm256_srli_epi32(values, 24), _mm256_setzero_si256());
+
+        __m256i exact = _mm256_blendv_epi8(values, _mm256_srli_epi32(values, 8), isLarge);
+
+        __m256i exponents = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(exact)), 23);
+
+        __m256i indices = _mm256_add_epi32(_mm256_sub_epi32(exponents, _mm256_set1_epi32(127)), _mm256_and_si256(isLarge, _mm256_set1_epi32(8)));
+
+        // Clamp the index of zero from -127 to 0
+        return _mm256_max_epi32(indices, _mm256_setzero_si256());
+    }
+#endif
+};
+
+/// Round an integer up to the next highest power of 2
+/// @note The integer must be in the range of [1, 2^(N-1)] where N is the integer width.
+struct NextPowerOf2Operation
+{
+    template <typename T>
+    requires std::unsigned_integral<T>
+    static inline T apply(T value) { return NextPowerOf2Finder<T>()(value); }
+
+#if defined(SIGNIFICANT_BIT_KERNELS_AVX512)
+    static inline __m512i apply32(__m512i values)
+    {
+        // 1 << (32 - lzcnt(value - 1)), which yields 1 for 1 without a special case
+        __m512i shifts = _mm512_sub_epi32(_mm512_set1_epi32(32), _mm512_lzcnt_epi32(_mm512_sub_epi32(values, _mm512_set1_epi32(1))));
+
+        return _mm512_sllv_epi32(_mm512_set1_epi32(1), shifts);
+    }
+
+    static inline __m512i apply64(__m512i values)
+    {
+        __m512i shifts = _mm512_sub_epi64(_mm512_set1_epi64(64), _mm512_lzcnt_epi64(_mm512_sub_epi64(values, _mm512_set1_epi64(1))));
+
+        return _mm512_sllv_epi64(_mm512_set1_epi64(1), shifts);
+    }
+#elif defined(SIGNIFICANT_BIT_KERNELS_AVX2)
+    static inline __m256i apply32(__m256i values)
+    {
+        __m256i ones = _mm256_set1_epi32(1);
+
+        // 1 << (MSB(value - 1) + 1), except that the MSB of zero is 0 rather than -1, so 1 needs a special case
+        __m256i shifts = _mm256_add_epi32(MostSignificantBitOperation::apply32(_mm256_sub_epi32(values, ones)), ones);
+
+        return _mm256_blendv_epi8(_mm256_sllv_epi32(ones, shifts), ones, _mm256_cmpeq_epi32(values, ones));
+    }
+#endif
+};
+
+//
+// MARK: - Kernels
+//
+
+/// Kernels that find the significant bits of an array of integers
+template <typename T>
+requires std::unsigned_integral<T>
+struct SignificantBitKernels
+{
+    ///
+    /// Apply the given operation to each element and store the result in the second array
+    ///
+    /// @tparam Operation Specify the operation
+    /// @tparam Result Specify the type of results, which is either `uint32_t` or `T`
+    /// @param values The array of integers
+    /// @param results The array that stores the results on return
+    /// @param count The number of elements in each array
+    /// @note `results[i] = Operation::apply(values[i])` for each `i` in `[0, count)`.
+    /// @note The two arrays may be the same if `Result` has the same size as `T`.
+    ///
+    template <typename Operation, typename Result>
+    static void transform(const T* values, Result* results, size_t count)
+    {
+        static_assert(sizeof(Result) == sizeof(uint32_t) || sizeof(Result) == sizeof(T), "Unsupported Result Width.");
+
+        size_t index = 0;
+
+#if defined(SIGNIFICANT_BIT_KERNELS_AVX512)
+        if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            for (; index + 16 <= count; index += 16)
+            {
+                _mm512_storeu_si512(results + index, Operation::apply32(_mm512_loadu_si512(values + index)));
+            }
+        }
+        else if constexpr (sizeof(T) == sizeof(uint64_t))
+        {
+            for (; index + 8 <= count; index += 8)
+            {
+                __m512i output = Operation::apply64(_mm512_loadu_si512(values + index));
+
+                // Narrow 64-bit indices to 32 bits
+                if constexpr (sizeof(Result) == sizeof(uint32_t))
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(results + index), _mm512_cvtepi64_epi32(output));
+                }
+                else
+                {
+                    _mm512_storeu_si512(results + index, output);
+                }
+            }
+        }
+#elif defined(SIGNIFICANT_BIT_KERNELS_AVX2)
+        if constexpr (sizeof(T) == sizeof(uint32_t))
+        {
+            for (; index + 8 <= count; index += 8)
+            {
+                __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(results + index), Operation::apply32(input));
+            }
+        }
+#endif
+
+        // Scalar fallback and the remaining elements
+        for (; index < count; index += 1)
+        {
+            results[index] = Operation::apply(values[index]);
+        }
+    }
+
+    ///
+    /// Find the LSB index of each integer in the given array
+    ///
+    /// @param values The array of integers
+    /// @param indices The array that stores the LSB indices on return
+    /// @param count The number of elements in each array
+    /// @note The LSB index of zero is 0, which is consistent with `LSBFinder`.
+    ///
+    static inline void findLeastSignificantBitIndices(const T* values, uint32_t* indices, size_t count)
+    {
+        transform<LeastSignificantBitOperation>(values, indices, count);
+    }
+
+    ///
+    /// Find the MSB index of each integer in the given array
+    ///
+    /// @param values The array of integers
+    /// @param indices The array that stores the MSB indices on return
+    /// @param count The number of elements in each array
+    /// @note The MSB index of zero is 0, which is consistent with `MSBFinder`.
+    ///
+    static inline void findMostSignificantBitIndices(const T* values, uint32_t* indices, size_t count)
+    {
+        transform<MostSignificantBitOperation>(values, indices, count);
+    }
+
+    ///
+    /// Round each integer in the given array up to the next highest power of 2
+    ///
+    /// @param values The array of integers, each of which must be in the range of [1, 2^(N-1)] where N is the integer width
+    /// @param results The array that stores the powers of 2 on return, which may be the same as `values`
+    /// @param count The number of elements in each array
+    /// @note This function suits computing the size classes of a batch of allocations.
+    ///
+    static inline void findNextPowersOf2(const T* values, T* results, size_t count)
+    {
+        transform<NextPowerOf2Operation>(values, results, count);
+    }
+};
+
+#endif /* SignificantBitKernels_hpp */
@@ -0,0 +1,322 @@
+//
+//  SkipList.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef SkipList_hpp
+#define SkipList_hpp
+
+#include <concepts>
+#include <functional>
+#include "SkipListable.hpp"
+#include "SignificantBit.hpp"
+
+///
+/// An intrusive skip list that keeps its nodes sorted
+///
+/// The skip list is a drop-in replacement of a `LinkedList` that is only modified by sorted insertions,
+/// e.g. a timer queue or a priority queue.
+/// Level 0 is a sorted doubly linked list of all nodes, and each higher level links about a quarter of the nodes of the level below it,
+/// so finding the insertion point visits an expected O(log n) nodes rather than walking from the head.
+/// Since each node is also doubly linked at its higher levels, removing a node or the head takes an expected O(1) time.
+///
+/// Nodes that compare equal keep their insertion order, which is consistent with `LinkedList::insert()`.
+///
+/// @tparam Node Specify the type of nodes
+/// @tparam Comparator Specify a callable type that returns `true` if the first node is less than the second one
+/// @note The comparator is part of the type rather than an argument of `insert()`,
+///       because all insertions must agree on the order that the higher levels are built on.
+/// @note Levels are drawn from a xorshift generator with a fixed seed, so the shape of the list is deterministic.
+///
+template <typename Node, typename Comparator = std::less<Node>>
+requires SkipListableItem<Node>
+class SkipList
+{
+    //
+    // MARK: - Metadata
+    //
+
+private:
+    /// Compile time constant that stores the maximum number of levels
+    static constexpr size_t MaxLevel = Node::MaxLevel;
+
+    /// The first node at each level
+    Node* heads[MaxLevel];
+
+    /// The list tail
+    Node* tail;
+
+    /// The current number of levels that have at least one node
+    size_t numLevels;
+
+    /// The current number of elements
+    size_t count;
+
+    /// The state of the random number generator
+    uint32_t seed;
+
+    /// The comparator that determines the order
+    Comparator comparator;
+
+    //
+    // MARK: - Private Helpers
+    //
+
+    ///
+    /// Draw the level of a new node
+    ///
+    /// @return A level in the range `[1, MaxLevel]`, where each level is 4 times less likely than the one below it.
+    ///
+    size_t drawLevel()
+    {
+        // Xorshift32
+        this->seed ^= this->seed << 13;
+
+        this->seed ^= this->seed >> 17;
+
+        this->seed ^= this->seed << 5;
+
+        // Each pair of trailing zeros promotes the node by one level
+        size_t level = LSBFinder<uint32_t>()(this->seed | 0x80000000) / 2 + 1;
+
+        return level < MaxLevel ? level : MaxLevel;
+    }
+
+    ///
+    /// Get the next node of the given node at the given level
+    ///
+    /// @param node A node, or `nullptr` to refer to the head of the list
+    /// @param level The level
+    /// @return The next node at the given level, `nullptr` if the given node is the last one at that level.
+    ///
+    inline Node* getNext(Node* node, size_t level) const
+    {
+        return node == nullptr ? this->heads[level] : node->links[level].next;
+    }
+
+    //
+    // MARK: - Constructor & Destructor
+    //
+
+public:
+    ///
+    /// Create an empty skip list
+    ///
+    /// @param comparator A comparator instance to determine the order
+    ///
+    explicit SkipList(Comparator comparator = Comparator()) : heads{}, tail(nullptr), numLevels(0), count(0), seed(2463534242), comparator(comparator) {}
+
+    //
+    // MARK: Queue Operations
+    //
+
+    ///
+    /// [Queue] Remove the first element from the list
+    ///
+    /// @return A non-null node if the list is not empty, `NULL` otherwise.
+    ///
+    Node* dequeue()
+    {
+        // Guard: Check whether the list is empty
+        if (this->isEmpty())
+        {
+            return nullptr;
+        }
+
+        Node* node = this->heads[0];
+
+        this->remove(node);
+
+        return node;
+    }
+
+    //
+    // MARK: List Operations
+    //
+
+    ///
+    /// Insert the given node in the order determined by the comparator
+    ///
+    /// @param node A non-null node to be inserted into the sorted list
+    /// @note The node is inserted after the nodes that compare equal to it.
+    ///
+    void insert(Node* node)
+    {
+        // The last node at each level that is not greater than the given node, `nullptr` if the node should be inserted at the front
+        Node* predecessors[MaxLevel];
+
+        Node* current = nullptr;
+
+        // Start from the highest level, and move down a level when the next node is greater than the given node
+        for (size_t level = this->numLevels; level-- > 0;)
+        {
+            for (Node* next = this->getNext(current, level); next != nullptr && !this->comparator(*node, *next); next = current->links[level].next)
+            {
+                current = next;
+            }
+
+            predecessors[level] = current;
+        }
+
+        // The new levels start empty, so the node is inserted at the front
+        node->level = this->drawLevel();
+
+        for (; this->numLevels < node->level; this->numLevels += 1)
+        {
+            predecessors[this->numLevels] = nullptr;
+        }
+
+        // Link the node at each of its levels
+        for (size_t level = 0; level < node->level; level += 1)
+        {
+            Node* prev = predecessors[level];
+
+            Node* next = this->getNext(prev, level);
+
+            node->links[level].prev = prev;
+
+            node->links[level].next = next;
+
+            if (prev == nullptr)
+            {
+                this->heads[level] = node;
+            }
+            else
+            {
+                prev->links[level].next = node;
+            }
+
+            if (next != nullptr)
+            {
+                next->links[level].prev = node;
+            }
+        }
+
+        // Guard: The node is inserted at the end of the list
+        if (node->links[0].next == nullptr)
+        {
+            this->tail = node;
+        }
+
+        this->count += 1;
+    }
+
+    ///
+    /// Remove the given node from the list
+    ///
+    /// @param node A non-null node to be removed from the list
+    /// @note This function assumes that the given node is in the list.
+    ///
+    void remove(Node* node)
+    {
+        // Guard: The node is the list tail
+        if (node == this->tail)
+        {
+            this->tail = node->links[0].prev;
+        }
+
+        // Unlink the node at each of its levels
+        for (size_t level = 0; level < node->level; level += 1)
+        {
+            Node* prev = node->links[level].prev;
+
+            Node* next = node->links[level].next;
+
+            if (prev == nullptr)
+            {
+                this->heads[level] = next;
+            }
+            else
+            {
+                prev->links[level].next = next;
+            }
+
+            if (next != nullptr)
+            {
+                next->links[level].prev = prev;
+            }
+
+            node->links[level].prev = nullptr;
+
+            node->links[level].next = nullptr;
+        }
+
+        // Drop the levels that become empty
+        while (this->numLevels > 0 && this->heads[this->numLevels - 1] == nullptr)
+        {
+            this->numLevels -= 1;
+        }
+
+        node->level = 0;
+
+        this->count -= 1;
+    }
+
+    //
+    // MARK: Query Skip List Properties
+    //
+
+    ///
+    /// Peek the head node of the list
+    ///
+    /// @return A constant reference to the current head node.
+    ///
+    [[nodiscard]]
+    const Node* peekHead() const
+    {
+        return this->heads[0];
+    }
+
+    ///
+    /// Peek the tail node of the list
+    ///
+    /// @return A constant reference to the current tail node.
+    ///
+    [[nodiscard]]
+    const Node* peekTail() const
+    {
+        return this->tail;
+    }
+
+    ///
+    /// Get the number of nodes in the list
+    ///
+    /// @return The number nodes in the list.
+    ///
+    [[nodiscard]]
+    size_t getCount() const
+    {
+        return this->count;
+    }
+
+    ///
+    /// Check whether the list is empty
+    ///
+    /// @return `true` if the list is empty, `false` otherwise.
+    ///
+    [[nodiscard]]
+    bool isEmpty() const
+    {
+        return this->count == 0;
+    }
+
+    ///
+    /// Call the given action on each element in sorted order
+    ///
+    /// @param action A functor that takes a constant reference to each element in the list
+    ///
+    template <typename Action>
+    requires std::invocable<Action, const Node*> && std::same_as<std::invoke_result_t<Action, const Node*>, void>
+    void forEach(Action action) const
+    {
+        for (Node* current = this->heads[0]; current != nullptr; current = current->links[0].next)
+        {
+            action(current);
+        }
+    }
+};
+
+#endif /* SkipList_hpp */
@@ -0,0 +1,56 @@
+//
+//  SkipListable.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef SkipListable_hpp
+#define SkipListable_hpp
+
+#include <concepts>
+#include <cstddef>
+
+///
+/// A type that can form an intrusive skip list
+///
+/// Each item is doubly linked at each of its levels, so that removing an item never searches for its predecessors.
+/// An item that is not in a list has a level of zero.
+///
+/// Memory Overhead: Two pointers per level, e.g. 192 bytes per item with 12 levels on a 64-bit system.
+///
+/// @tparam Item Specify the type of items
+/// @tparam NumLevels Specify the maximum number of levels,
+///                   which keeps the search logarithmic for up to about `4 ^ NumLevels` items
+///
+template <typename Item, size_t NumLevels = 12>
+requires (NumLevels > 0)
+class SkipListable
+{
+public:
+    /// Compile time constant that stores the maximum number of levels
+    static constexpr size_t MaxLevel = NumLevels;
+
+    /// The neighbors of an item at a level
+    struct Link
+    {
+        Item* prev;
+
+        Item* next;
+    };
+
+    /// The neighbors at each level, where level 0 links all items in the list
+    Link links[NumLevels];
+
+    /// The number of levels that the item is linked at
+    size_t level;
+
+    SkipListable() : links{}, level(0) {}
+};
+
+/// A concept to check whether a type is skip listable
+template <typename Item>
+concept SkipListableItem = std::derived_from<Item, SkipListable<Item, Item::MaxLevel>>;
+
+#endif /* SkipListable_hpp */
@@ -0,0 +1,420 @@
+//
+//  StaticBitVectorCountingIndex.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef StaticBitVectorCountingIndex_hpp
+#define StaticBitVectorCountingIndex_hpp
+
+#include <algorithm>
+#include "StaticBitVector.hpp"
+
+///
+/// An optional counting index that answers counting queries on a static bit vector in logarithmic time
+///
+/// The index keeps the number of set bits in each block of the bit vector in a Fenwick tree (i.e. a binary indexed tree),
+/// so that the number of set bits before any block is the sum of at most `log2(NumBlocks)` nodes.
+/// Unlike `StaticBitVectorRankCache`, which updates every later superblock when a bit changes,
+/// the index stays in sync as long as the bit vector is modified through the index,
+/// because setting or clearing a bit updates at most `log2(NumBlocks)` nodes.
+///
+/// Time Complexity: (B = The number of blocks)
+/// - `setBit()`, `clearBit()`, `rank()`, `countWithRange()`, `select()`: O(log B)
+/// - `setBits()`, `clearBits()`: O(log B) per block in the range
+/// - `findFirstWindowWith*Bits()`: O(log B) per window examined
+///
+/// Memory Overhead: One `size_t` per block, i.e. 100% of the bit vector if `StorageUnit` is `size_t`.
+/// Use a wider storage unit (e.g. `UInt256`) to reduce the overhead to 25% at the cost of counting more bits in the last block of a query.
+///
+/// @tparam NumBits Specify the total number of bits in the bit vector
+/// @tparam StorageUnit Specify the underlying integer type to store bits in the bit vector
+/// @warning The caller must call `rebuild()` after the bit vector is modified directly and before the index is queried again.
+///
+template <size_t NumBits, typename StorageUnit = size_t>
+requires ExtendedUnsignedIntegral<StorageUnit>
+class StaticBitVectorCountingIndex
+{
+private:
+    /// The type of the bit vector
+    using Vector = StaticBitVector<NumBits, StorageUnit>;
+
+    /// Compile time constant that stores the number of bits stored in each `BitOptions` block
+    static constexpr size_t NumBitsPerOptionsBlock = Vector::NumBitsPerOptionsBlock;
+
+    /// Compile time constant that stores the actual number of options in the bit vector
+    static constexpr size_t NumOptionsBlocks = Vector::NumOptionsBlocks;
+
+    static_assert(NumOptionsBlocks > 0, "The bit vector must contain at least one block.");
+
+    ///
+    /// Get the largest power of 2 that is not greater than the number of blocks
+    ///
+    /// @return The step of the first level of a descent from the root of the tree.
+    ///
+    static consteval size_t getDescentStep()
+    {
+        size_t step = 1;
+
+        while (step <= NumOptionsBlocks / 2)
+        {
+            step <<= 1;
+        }
+
+        return step;
+    }
+
+    /// The bit vector
+    Vector& vector;
+
+    /// The Fenwick tree, where `tree[i]` stores the number of set bits in the blocks in the range `[i - lowbit(i), i)`
+    /// The first element is unused, so that the tree is indexed from 1
+    size_t tree[NumOptionsBlocks + 1];
+
+    ///
+    /// Count the number of set bits before the given block
+    ///
+    /// @param block Index of the block, which may be equal to the number of blocks
+    /// @return The number of set bits in the blocks in the range `[0, block)`.
+    ///
+    [[nodiscard]]
+    inline size_t countBeforeBlock(size_t block) const
+    {
+        size_t count = 0;
+
+        // Remove the lowest set bit to move to the node that covers the preceding blocks
+        for (size_t node = block; node > 0; node &= node - 1)
+        {
+            count += this->tree[node];
+        }
+
+        return count;
+    }
+
+    ///
+    /// Record that the number of set bits in the given block has changed
+    ///
+    /// @param block Index of the block
+    /// @param oldCount The number of set bits in the block before the change
+    /// @param newCount The number of set bits in the block after the change
+    /// @note The unsigned arithmetic wraps around when the count decreases, and the sum is still correct.
+    ///
+    inline void updateBlock(size_t block, size_t oldCount, size_t newCount)
+    {
+        // Add the lowest set bit to move to the next node that also covers the block
+        for (size_t node = block + 1; node <= NumOptionsBlocks; node += node & (~node + 1))
+        {
+            this->tree[node] = this->tree[node] - oldCount + newCount;
+        }
+    }
+
+    ///
+    /// [Shared] Set or clear all bits in the given range and update the index
+    ///
+    /// @tparam Value Pass `true` to set bits, `false` to clear bits
+    /// @param range Specify the range of bits
+    ///
+    template <bool Value, typename Bound>
+    void fillBits(ClosedRange<Bound> range)
+    {
+        // Guard: The range must be within the vector
+        if (range.upperBound >= NumBits)
+        {
+            perr("The given range [%lu, %lu] is not valid.", static_cast<size_t>(range.lowerBound), static_cast<size_t>(range.upperBound));
+
+            return;
+        }
+
+        size_t fblock = range.lowerBound / NumBitsPerOptionsBlock;
+
+        size_t lblock = range.upperBound / NumBitsPerOptionsBlock;
+
+        if constexpr (Value)
+        {
+            this->vector.setBits(range);
+        }
+        else
+        {
+            this->vector.clearBits(range);
+        }
+
+        // The old count of each block is the difference between two adjacent prefix sums.
+        // Blocks are updated from the last one, because an update only changes the nodes after the block,
+        // which never contribute to the prefix sums of the preceding blocks.
+        size_t after = this->countBeforeBlock(lblock + 1);
+
+        for (size_t block = lblock + 1; block-- > fblock;)
+        {
+            size_t before = this->countBeforeBlock(block);
+
+            this->updateBlock(block, after - before, this->vector.blocks[block].count());
+
+            after = before;
+        }
+    }
+
+    ///
+    /// [Shared] Find the first aligned window that has at least the given number of set or zero bits
+    ///
+    /// @tparam Value Pass `true` to count set bits, `false` to count zero bits
+    /// @param length The number of bits in each window
+    /// @param count The minimum number of bits
+    /// @return The index of the first bit in the window on success, `-1` if no such window exists.
+    ///
+    template <bool Value>
+    ssize_t findFirstWindow(size_t length, size_t count) const
+    {
+        // Guard: Each window must have at least one bit
+        if (length == 0)
+        {
+            return -1;
+        }
+
+        // The prefix sum at the end of each window is the one at the start of the next window
+        size_t start = 0, before = 0;
+
+        while (start < NumBits)
+        {
+            // Guard: The addition might overflow
+            size_t end = length < NumBits - start ? start + length : NumBits;
+
+            size_t after = this->rank(end);
+
+            size_t numBits = Value ? after - before : (end - start) - (after - before);
+
+            if (numBits >= count)
+            {
+                return static_cast<ssize_t>(start);
+            }
+
+            start = end;
+
+            before = after;
+        }
+
+        return -1;
+    }
+
+public:
+    ///
+    /// Create the counting index of the given bit vector
+    ///
+    /// @param vector A bit vector that outlives the index
+    ///
+    explicit StaticBitVectorCountingIndex(Vector& vector) : vector(vector)
+    {
+        this->rebuild();
+    }
+
+    ///
+    /// Rebuild the index after the bit vector is modified directly
+    ///
+    /// @note This function builds the tree in linear time rather than updating it once per block.
+    ///
+    void rebuild()
+    {
+        this->tree[0] = 0;
+
+        for (size_t block = 0; block < NumOptionsBlocks; block += 1)
+        {
+            this->tree[block + 1] = this->vector.blocks[block].count();
+        }
+
+        // Each node passes its sum up to its parent, which covers the node as well as the preceding blocks
+        for (size_t node = 1; node <= NumOptionsBlocks; node += 1)
+        {
+            size_t parent = node + (node & (~node + 1));
+
+            if (parent <= NumOptionsBlocks)
+            {
+                this->tree[parent] += this->tree[node];
+            }
+        }
+    }
+
+    // MARK: Manipulate bits in the vector
+
+    ///
+    /// Set the bit at the given index and update the index
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    void setBit(size_t index)
+    {
+        // Guard: The bit is invalid or already set
+        if (index >= NumBits || this->vector.containsBit(index))
+        {
+            return;
+        }
+
+        this->vector.setBit(index);
+
+        this->updateBlock(index / NumBitsPerOptionsBlock, 0, 1);
+    }
+
+    ///
+    /// Clear the bit at the given index and update the index
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    void clearBit(size_t index)
+    {
+        // Guard: The bit is invalid or already clear
+        if (!this->vector.containsBit(index))
+        {
+            return;
+        }
+
+        this->vector.clearBit(index);
+
+        this->updateBlock(index / NumBitsPerOptionsBlock, 1, 0);
+    }
+
+    ///
+    /// Set all bits in the given range and update the index
+    ///
+    /// @param range Specify the range of bits to set
+    /// @warning This function has no effect if the given range is invalid.
+    ///
+    template <typename Bound = size_t>
+    void setBits(ClosedRange<Bound> range)
+    {
+        this->fillBits<true>(range);
+    }
+
+    ///
+    /// Clear all bits in the given range and update the index
+    ///
+    /// @param range Specify the range of bits to clear
+    /// @warning This function has no effect if the given range is invalid.
+    ///
+    template <typename Bound = size_t>
+    void clearBits(ClosedRange<Bound> range)
+    {
+        this->fillBits<false>(range);
+    }
+
+    // MARK: Count bits in the vector
+
+    ///
+    /// Count the number of set bits in the vector
+    ///
+    /// @return The number of set bits.
+    ///
+    [[nodiscard]]
+    inline size_t count() const
+    {
+        return this->countBeforeBlock(NumOptionsBlocks);
+    }
+
+    ///
+    /// Count the number of set bits before the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The number of set bits in the range `[0, index)`.
+    /// @note The number of all set bits is returned if the given index is not less than the total number of bits.
+    ///
+    [[nodiscard]]
+    size_t rank(size_t index) const
+    {
+        // Guard: All bits are before the given index
+        if (index >= NumBits)
+        {
+            return this->count();
+        }
+
+        size_t block = index / NumBitsPerOptionsBlock;
+
+        // Count the bits before the given index in its own block
+        return this->countBeforeBlock(block) + this->vector.blocks[block].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsSet(index % NumBitsPerOptionsBlock)).count();
+    }
+
+    ///
+    /// Count the number of set bits in the given range
+    ///
+    /// @param range Specify the range of bits to count
+    /// @return The number of set bits in the given range, `0` if the given range is invalid.
+    /// @note The number of zero bits, e.g. free frames, is `range.getLength()` minus the returned value.
+    ///
+    template <typename Bound = size_t> [[nodiscard]]
+    size_t countWithRange(ClosedRange<Bound> range) const
+    {
+        // Guard: The range must be within the vector
+        if (range.upperBound >= NumBits)
+        {
+            perr("The given range [%lu, %lu] is not valid.", static_cast<size_t>(range.lowerBound), static_cast<size_t>(range.upperBound));
+
+            return 0;
+        }
+
+        return this->rank(range.upperBound + 1) - this->rank(range.lowerBound);
+    }
+
+    ///
+    /// Find the position of the k-th set bit
+    ///
+    /// @param k Specify which set bit to find, starting from 0
+    /// @return The index of the k-th set bit on success, `-1` if the vector has no more than `k` bits set.
+    /// @note This function descends the tree rather than binary searching the prefix sums, so it examines `log2(NumBlocks)` nodes.
+    ///
+    [[nodiscard]]
+    ssize_t select(size_t k) const
+    {
+        // Guard: The vector does not have enough bits set
+        if (k >= this->count())
+        {
+            return -1;
+        }
+
+        // Find the number of leading blocks that have no more than `k` bits set in total
+        size_t block = 0;
+
+        for (size_t step = getDescentStep(); step > 0; step >>= 1)
+        {
+            if (block + step <= NumOptionsBlocks && this->tree[block + step] <= k)
+            {
+                block += step;
+
+                k -= this->tree[block];
+            }
+        }
+
+        return block * NumBitsPerOptionsBlock + this->vector.blocks[block].findNthSetBitIndex(k);
+    }
+
+    // MARK: Search windows in the vector
+
+    ///
+    /// Find the first aligned window that has at least the given number of set bits
+    ///
+    /// @param length The number of bits in each window, e.g. the number of frames in a NUMA node or a huge page
+    /// @param count The minimum number of set bits in the window
+    /// @return The index of the first bit in the window on success, `-1` if no such window exists.
+    /// @note Windows start at multiples of `length`, and the last window is shorter if `length` does not divide the number of bits.
+    ///
+    [[nodiscard]]
+    ssize_t findFirstWindowWithSetBits(size_t length, size_t count) const
+    {
+        return this->findFirstWindow<true>(length, count);
+    }
+
+    ///
+    /// Find the first aligned window that has at least the given number of zero bits
+    ///
+    /// @param length The number of bits in each window, e.g. the number of frames in a NUMA node or a huge page
+    /// @param count The minimum number of zero bits in the window
+    /// @return The index of the first bit in the window on success, `-1` if no such window exists.
+    /// @note Windows start at multiples of `length`, and the last window is shorter if `length` does not divide the number of bits.
+    ///
+    [[nodiscard]]
+    ssize_t findFirstWindowWithZeroBits(size_t length, size_t count) const
+    {
+        return this->findFirstWindow<false>(length, count);
+    }
+};
+
+#endif /* StaticBitVectorCountingIndex_hpp */
@@ -0,0 +1,247 @@
+//
+//  StaticBitVectorRankCache.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef StaticBitVectorRankCache_hpp
+#define StaticBitVectorRankCache_hpp
+
+#include <algorithm>
+#include "StaticBitVector.hpp"
+
+///
+/// An optional rank cache that accelerates `rank()` and `select()` queries on a static bit vector
+///
+/// The cache divides the bit vector into superblocks of `NumBlocksPerSuperblock` blocks,
+/// and records the number of set bits before each superblock.
+/// As a result, `rank()` examines at most `NumBlocksPerSuperblock` blocks,
+/// while `select()` binary searches the superblocks before examining at most `NumBlocksPerSuperblock` blocks.
+///
+/// Setting or clearing a bit through the cache adjusts the number of set bits before each later superblock,
+/// so the cache stays in sync without a linear scan of the bit vector.
+///
+/// Time Complexity: (B = The number of blocks, S = The number of superblocks)
+/// - `rank()`: O(NumBlocksPerSuperblock)
+/// - `select()`: O(log S + NumBlocksPerSuperblock)
+/// - `setBit()`, `clearBit()`: O(S), which only touches `B / NumBlocksPerSuperblock` words
+/// - `rebuild()`: O(B)
+///
+/// Memory Overhead: (NumBlocksPerSuperblock = 8, StorageUnit = UInt64)
+/// One `size_t` per 512 bits, i.e. 12.5% of the bit vector.
+///
+/// @tparam NumBits Specify the total number of bits in the bit vector
+/// @tparam StorageUnit Specify the underlying integer type to store bits in the bit vector
+/// @tparam NumBlocksPerSuperblock Specify the number of blocks in a superblock
+/// @warning The caller must call `rebuild()` after the bit vector is modified directly and before the cache is queried again.
+///
+template <size_t NumBits, typename StorageUnit = size_t, size_t NumBlocksPerSuperblock = 8>
+requires std::unsigned_integral<StorageUnit>
+class StaticBitVectorRankCache
+{
+private:
+    /// The type of the bit vector
+    using Vector = StaticBitVector<NumBits, StorageUnit>;
+
+    /// Compile time constant that stores the number of bits stored in each `BitOptions` block
+    static constexpr size_t NumBitsPerOptionsBlock = Vector::NumBitsPerOptionsBlock;
+
+    /// Compile time constant that stores the actual number of options in the bit vector
+    static constexpr size_t NumOptionsBlocks = Vector::NumOptionsBlocks;
+
+    /// Compile time constant that stores the number of superblocks
+    static constexpr size_t NumSuperblocks = (NumOptionsBlocks + NumBlocksPerSuperblock - 1) / NumBlocksPerSuperblock;
+
+    static_assert(NumBlocksPerSuperblock > 0, "A superblock must contain at least one block.");
+
+    /// The bit vector
+    Vector& vector;
+
+    /// The number of set bits before each superblock
+    /// The last element stores the total number of set bits
+    size_t ranks[NumSuperblocks + 1];
+
+public:
+    ///
+    /// Create the rank cache of the given bit vector
+    ///
+    /// @param vector A bit vector that outlives the cache
+    ///
+    explicit StaticBitVectorRankCache(Vector& vector) : vector(vector)
+    {
+        this->rebuild();
+    }
+
+    ///
+    /// Rebuild the cache after the bit vector is modified directly
+    ///
+    void rebuild()
+    {
+        size_t count = 0;
+
+        for (size_t superblock = 0; superblock < NumSuperblocks; superblock += 1)
+        {
+            this->ranks[superblock] = count;
+
+            size_t fblock = superblock * NumBlocksPerSuperblock;
+
+            size_t lblock = std::min(fblock + NumBlocksPerSuperblock, NumOptionsBlocks);
+
+            for (size_t block = fblock; block < lblock; block += 1)
+            {
+                count += this->vector.blocks[block].count();
+            }
+        }
+
+        this->ranks[NumSuperblocks] = count;
+    }
+
+    ///
+    /// Set the bit at the given index and update the cache
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    void setBit(size_t index)
+    {
+        // Guard: The bit is invalid or already set
+        if (index >= NumBits || this->vector.containsBit(index))
+        {
+            return;
+        }
+
+        this->vector.setBit(index);
+
+        for (size_t superblock = index / NumBitsPerOptionsBlock / NumBlocksPerSuperblock + 1; superblock <= NumSuperblocks; superblock += 1)
+        {
+            this->ranks[superblock] += 1;
+        }
+    }
+
+    ///
+    /// Clear the bit at the given index and update the cache
+    ///
+    /// @param index Index of the bit
+    /// @warning This function has no effect if the given index is invalid.
+    ///
+    void clearBit(size_t index)
+    {
+        // Guard: The bit is invalid or already clear
+        if (!this->vector.containsBit(index))
+        {
+            return;
+        }
+
+        this->vector.clearBit(index);
+
+        for (size_t superblock = index / NumBitsPerOptionsBlock / NumBlocksPerSuperblock + 1; superblock <= NumSuperblocks; superblock += 1)
+        {
+            this->ranks[superblock] -= 1;
+        }
+    }
+
+    ///
+    /// Count the number of set bits in the vector
+    ///
+    /// @return The number of set bits.
+    ///
+    [[nodiscard]]
+    inline size_t count() const
+    {
+        return this->ranks[NumSuperblocks];
+    }
+
+    ///
+    /// Count the number of set bits before the given index
+    ///
+    /// @param index Index of the bit
+    /// @return The number of set bits in the range `[0, index)`.
+    /// @note The number of all set bits is returned if the given index is not less than the total number of bits.
+    ///
+    [[nodiscard]]
+    size_t rank(size_t index) const
+    {
+        // Guard: All bits are before the given index
+        if (index >= NumBits)
+        {
+            return this->count();
+        }
+
+        size_t block = index / NumBitsPerOptionsBlock;
+
+        size_t superblock = block / NumBlocksPerSuperblock;
+
+        // Start with the number of set bits before the superblock
+        size_t count = this->ranks[superblock];
+
+        for (size_t current = superblock * NumBlocksPerSuperblock; current < block; current += 1)
+        {
+            count += this->vector.blocks[current].count();
+        }
+
+        // Count the bits before the given index in its own block
+        return count + this->vector.blocks[block].bitwiseAnd(BitMask<StorageUnit>::createWithLowBitsSet(index % NumBitsPerOptionsBlock)).count();
+    }
+
+    ///
+    /// Find the position of the k-th set bit
+    ///
+    /// @param k Specify which set bit to find, starting from 0
+    /// @return The index of the k-th set bit on success, `-1` if the vector has no more than `k` bits set or the cache is out of sync.
+    /// @warning The caller must call `rebuild()` after the bit vector is modified, otherwise the result is unreliable.
+    ///
+    [[nodiscard]]
+    ssize_t select(size_t k) const
+    {
+        // Guard: The vector does not have enough bits set
+        if (k >= this->count())
+        {
+            return -1;
+        }
+
+        // Binary search for the last superblock that has no more than `k` bits set before it
+        size_t lower = 0, upper = NumSuperblocks - 1;
+
+        while (lower < upper)
+        {
+            size_t middle = (lower + upper + 1) / 2;
+
+            if (this->ranks[middle] <= k)
+            {
+                lower = middle;
+            }
+            else
+            {
+                upper = middle - 1;
+            }
+        }
+
+        // Examine the blocks in the superblock
+        k -= this->ranks[lower];
+
+        size_t lblock = std::min((lower + 1) * NumBlocksPerSuperblock, NumOptionsBlocks);
+
+        for (size_t block = lower * NumBlocksPerSuperblock; block < lblock; block += 1)
+        {
+            size_t count = this->vector.blocks[block].count();
+
+            // Guard: Skip the current block if it has no more than `k` bits set
+            if (k >= count)
+            {
+                k -= count;
+
+                continue;
+            }
+
+            return block * NumBitsPerOptionsBlock + this->vector.blocks[block].findNthSetBitIndex(k);
+        }
+
+        perr("The rank cache is out of sync with the bit vector. Call rebuild() after modifying the bit vector.");
+
+        return -1;
+    }
+};
+
+#endif /* StaticBitVectorRankCache_hpp */
@@ -0,0 +1,42 @@
+//
+//  TreeNode.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef TreeNode_hpp
+#define TreeNode_hpp
+
+#include <concepts>
+
+///
+/// A type that can form an intrusive red-black tree
+///
+/// The links have distinct names from those of `Listable` and `Heapable`, so that an item can be in a tree and a list at the same time.
+///
+template <typename Item>
+class TreeNode
+{
+public:
+    /// The parent, `nullptr` if the item is the root
+    Item* parent;
+
+    /// The left child, whose subtree has items that are less than this item
+    Item* leftChild;
+
+    /// The right child, whose subtree has items that are not less than this item
+    Item* rightChild;
+
+    /// `true` if the item is red, `false` if it is black
+    bool isRed;
+
+    TreeNode() : parent(nullptr), leftChild(nullptr), rightChild(nullptr), isRed(false) {}
+};
+
+/// A concept to check whether a type can be a tree node
+template <typename Item>
+concept TreeNodeItem = std::derived_from<Item, TreeNode<Item>>;
+
+#endif /* TreeNode_hpp */
@@ -0,0 +1,346 @@
+//
+//  WideUnsignedInteger.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 2026-10-17.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef WideUnsignedInteger_hpp
+#define WideUnsignedInteger_hpp
+
+#include <cstdint>
+#include <cstddef>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+///
+/// Represents an unsigned integer that is wider than the widest native integer
+///
+/// The integer is stored as an array of 64-bit words from the least significant one,
+/// and supports the operators that `BitOptions` and bit vectors need to treat it as a block of bits.
+/// The word loops have a fixed trip count, so that bitwise operators on a 256-bit integer are compiled to
+/// a single load, operation and store on a 256-bit SIMD register (e.g. `vpand` with AVX2),
+/// while other targets still get straight-line code on 64-bit words.
+/// The storage is aligned to 16 bytes like the native 128-bit integer, because passing a parameter with a stricter alignment
+/// by value triggers ABI notes on x86-64 compilers.
+///
+/// @tparam NumWords Specify the number of 64-bit words
+///
+template <size_t NumWords>
+requires (NumWords >= 2)
+struct alignas(2 * sizeof(uint64_t)) WideUnsignedInteger
+{
+private:
+    /// The internal storage, where `words[0]` is the least significant word
+    uint64_t words[NumWords];
+
+    ///
+    /// Create an integer whose words are produced by the given function
+    ///
+    /// @param function A functor that takes the index of a word and returns its value
+    /// @return The integer whose word at each index `i` is `function(i)`.
+    /// @note Words are produced in ascending order of their indices, so that the function may carry a state from one word to the next.
+    ///       The expansion has no loop, so that the compiler keeps the words in registers rather than going through the stack.
+    ///
+    template <typename Function>
+    static constexpr WideUnsignedInteger generate(Function&& function)
+    {
+        return [&]<size_t... Indices>(std::index_sequence<Indices...>) -> WideUnsignedInteger
+        {
+            WideUnsignedInteger result;
+
+            // The comma operator evaluates its operands from left to right
+            ((result.words[Indices] = function(Indices)), ...);
+
+            return result;
+        }(std::make_index_sequence<NumWords>());
+    }
+
+public:
+    /// Compile time constant that stores the number of bits in the integer
+    static constexpr size_t NumBits = NumWords * 64;
+
+    /// Create a zero integer
+    constexpr WideUnsignedInteger() : words{} {}
+
+    /// Create an integer from the given native integer, which is zero extended like an integer promotion
+    constexpr WideUnsignedInteger(uint64_t value) : words{value} {}
+
+    ///
+    /// Create an integer with low `n` bits set
+    ///
+    /// @param n Specify the number of low consecutive bits set
+    /// @return An integer with low `n` bits set.
+    /// @note This function builds each word directly, which is much cheaper than `(1 << n) - 1` on a wide integer.
+    ///
+    static constexpr WideUnsignedInteger createWithLowBitsSet(size_t n)
+    {
+        return generate([n](size_t index) -> uint64_t
+        {
+            size_t low = index * 64;
+
+            if (n >= low + 64)
+            {
+                return ~0ULL;
+            }
+
+            return n <= low ? 0 : (1ULL << (n - low)) - 1;
+        });
+    }
+
+    ///
+    /// Get the 64-bit word at the given index
+    ///
+    /// @param index Index of the word, where 0 refers to the least significant word
+    /// @return The word at the given index.
+    ///
+    [[nodiscard]]
+    constexpr uint64_t getWord(size_t index) const
+    {
+        return this->words[index];
+    }
+
+    /// Truncate the integer to its least significant word
+    constexpr explicit operator uint64_t() const
+    {
+        return this->words[0];
+    }
+
+    /// Check whether the integer is not zero
+    constexpr explicit operator bool() const
+    {
+        return *this != 0;
+    }
+
+    // MARK: Bitwise Operators
+
+    friend constexpr WideUnsignedInteger operator~(const WideUnsignedInteger& value)
+    {
+        return generate([&](size_t index) -> uint64_t { return ~value.words[index]; });
+    }
+
+    friend constexpr WideUnsignedInteger operator&(const WideUnsignedInteger& lhs, const WideUnsignedInteger& rhs)
+    {
+        return generate([&](size_t index) -> uint64_t { return lhs.words[index] & rhs.words[index]; });
+    }
+
+    friend constexpr WideUnsignedInteger operator|(const WideUnsignedInteger& lhs, const WideUnsignedInteger& rhs)
+    {
+        return generate([&](size_t index) -> uint64_t { return lhs.words[index] | rhs.words[index]; });
+    }
+
+    friend constexpr WideUnsignedInteger operator^(const WideUnsignedInteger& lhs, const WideUnsignedInteger& rhs)
+    {
+        return generate([&](size_t index) -> uint64_t { return lhs.words[index] ^ rhs.words[index]; });
+    }
+
+    constexpr WideUnsignedInteger& operator&=(const WideUnsignedInteger& rhs)
+    {
+        return *this = *this & rhs;
+    }
+
+    constexpr WideUnsignedInteger& operator|=(const WideUnsignedInteger& rhs)
+    {
+        return *this = *this | rhs;
+    }
+
+    constexpr WideUnsignedInteger& operator^=(const WideUnsignedInteger& rhs)
+    {
+        return *this = *this ^ rhs;
+    }
+
+    // MARK: Shift Operators
+
+    ///
+    /// Shift the integer to the left by the given number of bits
+    ///
+    /// @param lhs The integer to shift
+    /// @param count The number of bits
+    /// @return The shifted integer.
+    /// @note Unlike native integers, shifting by the integer width or more is well defined and yields zero.
+    ///
+    friend constexpr WideUnsignedInteger operator<<(const WideUnsignedInteger& lhs, size_t count)
+    {
+        size_t wordShift = count / 64;
+
+        size_t bitShift = count % 64;
+
+        // Each word is made of the word `wordShift` positions below it and the bits carried from the word below that one
+        return generate([&](size_t index) -> uint64_t
+        {
+            uint64_t word = index >= wordShift ? lhs.words[index - wordShift] << bitShift : 0;
+
+            uint64_t carry = index >= wordShift + 1 && bitShift != 0 ? lhs.words[index - wordShift - 1] >> (64 - bitShift) : 0;
+
+            return word | carry;
+        });
+    }
+
+    ///
+    /// Shift the integer to the right by the given number of bits
+    ///
+    /// @param lhs The integer to shift
+    /// @param count The number of bits
+    /// @return The shifted integer.
+    /// @note Unlike native integers, shifting by the integer width or more is well defined and yields zero.
+    ///
+    friend constexpr WideUnsignedInteger operator>>(const WideUnsignedInteger& lhs, size_t count)
+    {
+        size_t wordShift = count / 64;
+
+        size_t bitShift = count % 64;
+
+        return generate([&](size_t index) -> uint64_t
+        {
+            uint64_t word = index + wordShift < NumWords ? lhs.words[index + wordShift] >> bitShift : 0;
+
+            uint64_t carry = index + wordShift + 1 < NumWords && bitShift != 0 ? lhs.words[index + wordShift + 1] << (64 - bitShift) : 0;
+
+            return word | carry;
+        });
+    }
+
+    constexpr WideUnsignedInteger& operator<<=(size_t count)
+    {
+        return *this = *this << count;
+    }
+
+    constexpr WideUnsignedInteger& operator>>=(size_t count)
+    {
+        return *this = *this >> count;
+    }
+
+    // MARK: Arithmetic Operators
+
+    /// Add two integers modulo 2^N where N is the integer width
+    friend constexpr WideUnsignedInteger operator+(const WideUnsignedInteger& lhs, const WideUnsignedInteger& rhs)
+    {
+        uint64_t carry = 0;
+
+        return generate([&](size_t index) -> uint64_t
+        {
+            uint64_t sum = lhs.words[index] + rhs.words[index];
+
+            uint64_t result = sum + carry;
+
+            carry = (sum < lhs.words[index]) | (result < sum);
+
+            return result;
+        });
+    }
+
+    /// Subtract two integers modulo 2^N where N is the integer width
+    friend constexpr WideUnsignedInteger operator-(const WideUnsignedInteger& lhs, const WideUnsignedInteger& rhs)
+    {
+        uint64_t borrow = 0;
+
+        return generate([&](size_t index) -> uint64_t
+        {
+            uint64_t difference = lhs.words[index] - rhs.words[index];
+
+            uint64_t result = difference - borrow;
+
+            borrow = (lhs.words[index] < rhs.words[index]) | (difference < borrow);
+
+            return result;
+        });
+    }
+
+    /// Negate the integer modulo 2^N, so that `value & -value` isolates the lowest set bit as with native integers
+    friend constexpr WideUnsignedInteger operator-(const WideUnsignedInteger& value)
+    {
+        return WideUnsignedInteger() - value;
+    }
+
+    constexpr WideUnsignedInteger& operator+=(const WideUnsignedInteger& rhs)
+    {
+        return *this = *this + rhs;
+    }
+
+    constexpr WideUnsignedInteger& operator-=(const WideUnsignedInteger& rhs)
+    {
+        return *this = *this - rhs;
+    }
+
+    // MARK: Comparison Operators
+
+    /// Check whether two integers are equal
+    friend constexpr bool operator==(const WideUnsignedInteger& lhs, const WideUnsignedInteger& rhs)
+    {
+        // Accumulate the differences rather than returning early, so that the comparison is branchless
+        uint64_t difference = 0;
+
+        for (size_t index = 0; index < NumWords; index += 1)
+        {
+            difference |= lhs.words[index] ^ rhs.words[index];
+        }
+
+        return difference == 0;
+    }
+};
+
+///
+/// Check whether the given type is an instance of `WideUnsignedInteger`
+///
+template <typename T>
+struct IsWideUnsignedInteger : std::false_type {};
+
+template <size_t NumWords>
+struct IsWideUnsignedInteger<WideUnsignedInteger<NumWords>> : std::true_type {};
+
+//
+// MARK: - Aliases
+//
+// `UInt128` is the native `unsigned __int128` if the compiler supports it, and a two-word integer otherwise.
+// `UInt256` is always a four-word integer, because no compiler provides a native 256-bit integer.
+//
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 UInt128;
+#else
+using UInt128 = WideUnsignedInteger<2>;
+#endif
+
+using UInt256 = WideUnsignedInteger<4>;
+
+///
+/// Specify an unsigned integer type that is wider than 64 bits,
+/// i.e. `UInt128`, `UInt256` or any other instance of `WideUnsignedInteger`
+///
+/// @note `std::unsigned_integral<unsigned __int128>` is only satisfied with GNU extensions enabled (e.g. `-std=gnu++20`),
+///       so this concept recognizes the native 128-bit integer explicitly.
+///
+template <typename T>
+concept WideUnsignedIntegral = (std::same_as<T, UInt128> || IsWideUnsignedInteger<T>::value) && sizeof(T) > sizeof(uint64_t);
+
+///
+/// Specify an unsigned integer type that is either a native one (e.g. `uint8_t`) or a wide one (e.g. `UInt256`)
+///
+/// @note Types that satisfy this concept can be used as the storage unit of `BitOptions` and `StaticBitVector`.
+///
+template <typename T>
+concept ExtendedUnsignedIntegral = std::unsigned_integral<T> || WideUnsignedIntegral<T>;
+
+///
+/// Get the 64-bit word at the given index of a wide unsigned integer
+///
+/// @param value A wide unsigned integer
+/// @param index Index of the word, where 0 refers to the least significant word
+/// @return The word at the given index.
+///
+template <typename T>
+requires WideUnsignedIntegral<T>
+static constexpr uint64_t getWideIntegerWord(const T& value, size_t index)
+{
+    if constexpr (IsWideUnsignedInteger<T>::value)
+    {
+        return value.getWord(index);
+    }
+    else
+    {
+        return static_cast<uint64_t>(value >> (index * 64));
+    }
+}
+
+#endif /* WideUnsignedInteger_hpp */
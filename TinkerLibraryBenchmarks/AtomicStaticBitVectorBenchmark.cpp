@@ -0,0 +1,172 @@
+//
+//  AtomicStaticBitVectorBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "AtomicStaticBitVectorBenchmark.hpp"
+#include "AtomicStaticBitVector.hpp"
+#include "StaticBitVector.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/// The number of IDs managed by the bit vector
+static constexpr size_t kNumBits = 1 << 16;
+
+/// The number of IDs each thread holds at a time
+static constexpr size_t kNumIDsPerBatch = 32;
+
+/// The number of batches each thread claims and then releases
+static constexpr size_t kNumBatchesPerThread = 20000;
+
+/// The number of trials for each configuration
+static constexpr size_t kTrials = 5;
+
+/// The lock-free bit vector under test
+static AtomicStaticBitVector<kNumBits> atomicVector;
+
+/// The locked bit vector under test, which is the status quo
+static StaticBitVector<kNumBits> lockedVector;
+
+/// The spin lock that protects the locked bit vector
+static std::atomic_flag lock = ATOMIC_FLAG_INIT;
+
+/// Acquire the spin lock
+static inline void acquireLock()
+{
+    while (lock.test_and_set(std::memory_order_acquire))
+    {
+        // Wait until the lock is released without writing to the cache line
+        while (lock.test(std::memory_order_relaxed)) {}
+    }
+}
+
+/// Release the spin lock
+static inline void releaseLock()
+{
+    lock.clear(std::memory_order_release);
+}
+
+///
+/// Run the given workload on the given number of threads concurrently
+///
+/// @param numThreads The number of threads
+/// @param workload A callable that takes the index of the thread
+///
+template <typename Workload>
+static void runOnThreads(size_t numThreads, Workload workload)
+{
+    std::vector<std::thread> threads;
+
+    threads.reserve(numThreads);
+
+    for (size_t thread = 0; thread < numThreads; thread += 1)
+    {
+        threads.emplace_back(workload, thread);
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+uint64_t AtomicStaticBitVectorBenchmark::benchmarkLockFree(size_t numThreads)
+{
+    atomicVector.initWithZeros();
+
+    return ExecutionTimeMeasurer()(kTrials, runOnThreads<void (*)(size_t)>, numThreads, [](size_t thread) -> void
+    {
+        ssize_t ids[kNumIDsPerBatch];
+
+        // Each thread starts the search in its own region
+        size_t hint = thread * (kNumBits / 64);
+
+        for (size_t batch = 0; batch < kNumBatchesPerThread; batch += 1)
+        {
+            for (auto& id : ids)
+            {
+                id = atomicVector.claimFirstZero(hint);
+
+                passert(id >= 0, "The vector should never be full.");
+            }
+
+            for (auto id : ids)
+            {
+                atomicVector.testAndClear(id);
+            }
+        }
+    });
+}
+
+uint64_t AtomicStaticBitVectorBenchmark::benchmarkLocked(size_t numThreads)
+{
+    lockedVector.initWithZeros();
+
+    return ExecutionTimeMeasurer()(kTrials, runOnThreads<void (*)(size_t)>, numThreads, [](size_t) -> void
+    {
+        ssize_t ids[kNumIDsPerBatch];
+
+        for (size_t batch = 0; batch < kNumBatchesPerThread; batch += 1)
+        {
+            for (auto& id : ids)
+            {
+                acquireLock();
+
+                id = lockedVector.findFirstZeroBitIndex();
+
+                lockedVector.setBit(id);
+
+                releaseLock();
+
+                passert(id >= 0, "The vector should never be full.");
+            }
+
+            for (auto id : ids)
+            {
+                acquireLock();
+
+                lockedVector.clearBit(id);
+
+                releaseLock();
+            }
+        }
+    });
+}
+
+void AtomicStaticBitVectorBenchmark::run()
+{
+    pmesg("==== BENCHMARK ATOMIC STATIC BIT VECTOR STARTED ====");
+
+    size_t maxThreads = std::max(std::thread::hardware_concurrency(), 1U);
+
+    // Double the number of threads until all processors are busy
+    for (size_t numThreads = 1; true; numThreads = std::min(numThreads * 2, maxThreads))
+    {
+        uint64_t locked = AtomicStaticBitVectorBenchmark::benchmarkLocked(numThreads);
+
+        uint64_t lockFree = AtomicStaticBitVectorBenchmark::benchmarkLockFree(numThreads);
+
+        // Each batch claims and releases every ID, i.e. two operations per ID
+        double numOperations = static_cast<double>(numThreads * kNumBatchesPerThread * kNumIDsPerBatch * 2);
+
+        pmesg("Threads = %3lu; Locked = %7.2f Mops/s; Lock-Free = %7.2f Mops/s; Speedup = %5.1fx.",
+              numThreads,
+              numOperations / static_cast<double>(locked == 0 ? 1 : locked) * 1e3,
+              numOperations / static_cast<double>(lockFree == 0 ? 1 : lockFree) * 1e3,
+              static_cast<double>(locked) / static_cast<double>(lockFree == 0 ? 1 : lockFree));
+
+        if (numThreads == maxThreads)
+        {
+            break;
+        }
+    }
+
+    pmesg("==== BENCHMARK ATOMIC STATIC BIT VECTOR FINISHED ====");
+}
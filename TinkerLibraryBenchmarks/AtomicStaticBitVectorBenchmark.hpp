@@ -0,0 +1,29 @@
+//
+//  AtomicStaticBitVectorBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef AtomicStaticBitVectorBenchmark_hpp
+#define AtomicStaticBitVectorBenchmark_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include "TestSuite.hpp"
+
+class AtomicStaticBitVectorBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Measure the time for the given number of threads to claim and release IDs with the lock-free bit vector
+    static uint64_t benchmarkLockFree(size_t numThreads);
+
+    /// Measure the time for the given number of threads to claim and release IDs with a spin-locked bit vector
+    static uint64_t benchmarkLocked(size_t numThreads);
+};
+
+#endif /* AtomicStaticBitVectorBenchmark_hpp */
@@ -0,0 +1,123 @@
+//
+//  BitMatrixBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "BitMatrixBenchmark.hpp"
+#include "BitMatrix.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+
+/// The number of bits in each row
+static constexpr size_t kNumBits = 1 << 20;
+
+/// The number of trials for each operation
+static constexpr size_t kTrials = 21;
+
+/// The matrix under test, which is too large to live on the stack
+static BitMatrix<4, kNumBits> matrix;
+
+/// The rows of the matrix
+using Row = BitMatrix<4, kNumBits>::Row;
+
+/// The result and the temporary vectors of the materializing evaluation
+static Row result, temporary;
+
+///
+/// Evaluate `(A & B) | ~C` by materializing each intermediate result with the bulk operators of bit vectors
+///
+/// @return The result.
+///
+static const Row& evaluateWithTemporaries()
+{
+    result = matrix.getRow(0);
+
+    result &= matrix.getRow(1);
+
+    temporary.initWithOnes();
+
+    temporary.andNot(matrix.getRow(2));
+
+    result |= temporary;
+
+    return result;
+}
+
+void BitMatrixBenchmark::run()
+{
+    pmesg("==== BENCHMARK BIT MATRIX STARTED ====");
+
+    // Each row has about half of its bits set, except that C has most of its bits set, so that the result is sparse
+    uint64_t seed = 2020;
+
+    for (size_t row = 0; row < matrix.getNumRows(); row += 1)
+    {
+        matrix.getRow(row).initWithZeros();
+
+        for (size_t index = 0; index < kNumBits; index += 1)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+            if ((seed >> 33) % 1024 < (row == 2 ? 1023 : 512))
+            {
+                matrix.getRow(row).setBit(index);
+            }
+        }
+    }
+
+    BitMatrixRow a(0), b(1), c(2);
+
+    auto expression = (a & b) | ~c;
+
+    Throughput fusedEvaluate = ThroughputMeasurer()(kTrials, kNumBits, [&]() { matrix.evaluate(expression, result); return result.containsBit(kNumBits - 1); });
+
+    Throughput unfusedEvaluate = ThroughputMeasurer()(kTrials, kNumBits, []() { return evaluateWithTemporaries().containsBit(kNumBits - 1); });
+
+    Throughput unfusedCount = ThroughputMeasurer()(kTrials, kNumBits, []() { return evaluateWithTemporaries().count(); });
+
+    Throughput fusedCount = ThroughputMeasurer()(kTrials, kNumBits, [&]() { return matrix.count(expression); });
+
+    // The first set bit of `A & B & C & D` is close to the start, so the fused search stops early
+    auto conjunction = a & b & c & BitMatrixRow(3);
+
+    Throughput fusedSearch = ThroughputMeasurer()(kTrials, kNumBits, [&]() { return matrix.findFirstSetBit(conjunction); });
+
+    Throughput unfusedSearch = ThroughputMeasurer()(kTrials, kNumBits, []()
+    {
+        result = matrix.getRow(0);
+
+        result &= matrix.getRow(1);
+
+        result &= matrix.getRow(2);
+
+        result &= matrix.getRow(3);
+
+        return result.findLeastSignificantBitIndex();
+    });
+
+    matrix.evaluate(expression, temporary);
+
+    size_t count = temporary.count();
+
+    passert(count == evaluateWithTemporaries().count() && count == matrix.count(expression), "All evaluations must agree.");
+
+    const std::pair<const char*, std::pair<Throughput, Throughput>> throughputs[] =
+    {
+        { "Evaluate", { unfusedEvaluate, fusedEvaluate } },
+        { "Count   ", { unfusedCount, fusedCount } },
+        { "Search  ", { unfusedSearch, fusedSearch } },
+    };
+
+    for (const auto& [operation, pair] : throughputs)
+    {
+        auto [unfused, fused] = pair;
+
+        pmesg("NumBits = %lu; Operation = %s; Temporaries = %7.4f ns/bit; Fused = %7.4f ns/bit; Speedup = %5.1fx.",
+              kNumBits, operation, unfused.nanosecondsPerOperation, fused.nanosecondsPerOperation, unfused.nanosecondsPerOperation / fused.nanosecondsPerOperation);
+    }
+
+    pmesg("==== BENCHMARK BIT MATRIX FINISHED ====");
+}
@@ -0,0 +1,20 @@
+//
+//  BitMatrixBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitMatrixBenchmark_hpp
+#define BitMatrixBenchmark_hpp
+
+#include "TestSuite.hpp"
+
+class BitMatrixBenchmark: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* BitMatrixBenchmark_hpp */
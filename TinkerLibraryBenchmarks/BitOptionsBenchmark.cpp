@@ -0,0 +1,199 @@
+//
+//  BitOptionsBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "BitOptionsBenchmark.hpp"
+#include "BitOptions.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+
+/// The number of bit options examined per trial
+static constexpr size_t kNumOptions = 1 << 14;
+
+/// The number of trials for each operation
+static constexpr size_t kTrials = 21;
+
+template <typename T>
+void BitOptionsBenchmark::benchmarkOptions()
+{
+    // Each block has about a quarter of its bits set
+    static BitOptions<T> options[kNumOptions];
+
+    uint64_t seed = 2020;
+
+    for (auto& option : options)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        option = BitOptions<T>(static_cast<T>((seed >> 8) & (seed >> 24)) | 1);
+    }
+
+    Throughput lsb = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            sum += option.findLeastSignificantBitIndex();
+        }
+
+        return sum;
+    });
+
+    Throughput msb = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            sum += option.findMostSignificantBitIndex();
+        }
+
+        return sum;
+    });
+
+    Throughput count = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            sum += option.count();
+        }
+
+        return sum;
+    });
+
+    // Traversals are measured per set bit rather than per block
+    size_t numSetBits = 0;
+
+    for (const auto& option : options)
+    {
+        numSetBits += option.count();
+    }
+
+    Throughput iterator = ThroughputMeasurer()(kTrials, numSetBits, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            for (uint32_t index : option)
+            {
+                sum += index;
+            }
+        }
+
+        return sum;
+    });
+
+    Throughput visitor = ThroughputMeasurer()(kTrials, numSetBits, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            option.forEachSetBit([&](uint32_t index) -> void { sum += index; });
+        }
+
+        return sum;
+    });
+
+    // Select the median set bit of each block, which is what a random victim selection does on average
+    Throughput nthSetBit = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            sum += option.findNthSetBitIndex(option.count() / 2);
+        }
+
+        return sum;
+    });
+
+    // The loop that `findNthSetBitIndex()` replaces
+    Throughput nthSetBitLoop = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            T value = option.flatten();
+
+            for (uint32_t k = option.count() / 2; k > 0; k -= 1)
+            {
+                value &= value - 1;
+            }
+
+            sum += BitOptions<T>(value).findLeastSignificantBitIndex();
+        }
+
+        return sum;
+    });
+
+    // Gather and scatter with a mask that has every other bit set
+    static constexpr T kMask = static_cast<T>(0x5555555555555555ULL);
+
+    Throughput extract = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            sum += option.extract(kMask).flatten();
+        }
+
+        return sum;
+    });
+
+    Throughput deposit = ThroughputMeasurer()(kTrials, kNumOptions, []()
+    {
+        uint64_t sum = 0;
+
+        for (const auto& option : options)
+        {
+            sum += option.deposit(kMask).flatten();
+        }
+
+        return sum;
+    });
+
+    const std::pair<const char*, Throughput> results[] =
+    {
+        { "LSB",           lsb           },
+        { "MSB",           msb           },
+        { "Count",         count         },
+        { "Iterator",      iterator      },
+        { "ForEachSetBit", visitor       },
+        { "NthSetBit",     nthSetBit     },
+        { "NthSetBitLoop", nthSetBitLoop },
+        { "Extract",       extract       },
+        { "Deposit",       deposit       },
+    };
+
+    for (const auto& [operation, throughput] : results)
+    {
+        pmesg("Width = %2lu; Operation = %-13s; %6.2f ns/op (%8.1f Mops/s).",
+              sizeof(T) * 8, operation, throughput.nanosecondsPerOperation, throughput.operationsPerSecond / 1e6);
+    }
+}
+
+void BitOptionsBenchmark::run()
+{
+    pmesg("==== BENCHMARK BIT OPTIONS STARTED ====");
+
+    BitOptionsBenchmark::benchmarkOptions<uint8_t>();
+
+    BitOptionsBenchmark::benchmarkOptions<uint16_t>();
+
+    BitOptionsBenchmark::benchmarkOptions<uint32_t>();
+
+    BitOptionsBenchmark::benchmarkOptions<uint64_t>();
+
+    pmesg("==== BENCHMARK BIT OPTIONS FINISHED ====");
+}
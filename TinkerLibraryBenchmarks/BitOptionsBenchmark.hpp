@@ -0,0 +1,25 @@
+//
+//  BitOptionsBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitOptionsBenchmark_hpp
+#define BitOptionsBenchmark_hpp
+
+#include "TestSuite.hpp"
+
+class BitOptionsBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Measure the searches, counting and set bit traversals on bit options of the given type
+    template <typename T>
+    static void benchmarkOptions();
+};
+
+#endif /* BitOptionsBenchmark_hpp */
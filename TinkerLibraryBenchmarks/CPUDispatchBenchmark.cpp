@@ -0,0 +1,161 @@
+//
+//  CPUDispatchBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "CPUDispatchBenchmark.hpp"
+#include "CPUDispatch.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+#include <cstring>
+#include <vector>
+
+/// The number of integers passed to the bit kernels per trial
+static constexpr size_t kNumValues = 1 << 16;
+
+/// The number of trials for each kernel
+static constexpr size_t kTrials = 21;
+
+///
+/// Get the table of each tier of kernels that the current processor supports, from the portable one to the best one
+///
+/// @return The tables, which may select the same variant for a kernel more than once.
+///
+static std::vector<CPUDispatchTable> createTables()
+{
+    CPUFeatures detected = CPUFeatures::detect();
+
+    CPUFeatures scalar = {};
+
+    scalar.popcnt = detected.popcnt;
+
+    scalar.lzcnt = detected.lzcnt;
+
+    scalar.erms = detected.erms;
+
+    // Leave out ERMS, so that the AVX2 kernels are used for all lengths
+    CPUFeatures avx2 = scalar;
+
+    avx2.avx2 = detected.avx2;
+
+    avx2.erms = false;
+
+    std::vector<CPUDispatchTable> tables;
+
+    for (const CPUFeatures& features : { CPUFeatures(), scalar, avx2, detected })
+    {
+        tables.push_back(CPUDispatchTable::createWithFeatures(features));
+    }
+
+    return tables;
+}
+
+void CPUDispatchBenchmark::benchmarkBitKernels()
+{
+    static uint64_t values[kNumValues];
+
+    static uint32_t indices[kNumValues];
+
+    uint64_t seed = 2020;
+
+    for (auto& value : values)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        value = (seed >> 8) >> ((seed >> 2) % 64);
+    }
+
+    for (const CPUDispatchTable& table : createTables())
+    {
+        Throughput lsb = ThroughputMeasurer()(kTrials, kNumValues, [&]()
+        {
+            table.findLeastSignificantBitIndices.function(values, indices, kNumValues);
+
+            return indices[kNumValues - 1];
+        });
+
+        Throughput msb = ThroughputMeasurer()(kTrials, kNumValues, [&]()
+        {
+            table.findMostSignificantBitIndices.function(values, indices, kNumValues);
+
+            return indices[kNumValues - 1];
+        });
+
+        Throughput pop = ThroughputMeasurer()(kTrials, kNumValues, [&]() { return table.countSetBits.function(values, kNumValues); });
+
+        pmesg("Operation = LSB; Variant = %-8s; %6.3f ns/op (%8.1f Mops/s).", table.findLeastSignificantBitIndices.variant, lsb.nanosecondsPerOperation, lsb.operationsPerSecond / 1e6);
+
+        pmesg("Operation = MSB; Variant = %-8s; %6.3f ns/op (%8.1f Mops/s).", table.findMostSignificantBitIndices.variant, msb.nanosecondsPerOperation, msb.operationsPerSecond / 1e6);
+
+        pmesg("Operation = POP; Variant = %-8s; %6.3f ns/op (%8.1f Mops/s).", table.countSetBits.variant, pop.nanosecondsPerOperation, pop.operationsPerSecond / 1e6);
+    }
+}
+
+void CPUDispatchBenchmark::benchmarkMemoryKernels()
+{
+    static constexpr size_t kMaxLength = 1UL << 20;
+
+    std::vector<uint8_t> source(kMaxLength, 0x5A), destination(kMaxLength);
+
+    for (size_t length : { 16UL, 100UL, 4096UL, kMaxLength })
+    {
+        // Repeat short copies, so that the duration is long enough to measure
+        size_t repeats = kMaxLength / length;
+
+        auto measure = [&](auto&& kernel)
+        {
+            return ThroughputMeasurer()(kTrials, repeats, [&]()
+            {
+                for (size_t repeat = 0; repeat < repeats; repeat += 1)
+                {
+                    kernel();
+                }
+
+                return destination[length - 1];
+            });
+        };
+
+        auto report = [&](const char* operation, const char* variant, Throughput throughput)
+        {
+            pmesg("Operation = %s; Length = %7lu; Variant = %-8s; %9.2f ns/op (%6.2f GB/s).",
+                  operation, length, variant, throughput.nanosecondsPerOperation, static_cast<double>(length) / throughput.nanosecondsPerOperation);
+        };
+
+        for (const CPUDispatchTable& table : createTables())
+        {
+            report("Copy", table.copyMemory.variant, measure([&]() { table.copyMemory.function(destination.data(), source.data(), length); }));
+
+            report("Fill", table.fillMemory.variant, measure([&]() { table.fillMemory.function(destination.data(), static_cast<int>(length), length); }));
+        }
+
+        // Hide the length from the compiler, so that the C library is called rather than inlined
+        volatile size_t opaque = length;
+
+        report("Copy", "libc", measure([&]() { memcpy(destination.data(), source.data(), opaque); }));
+
+        report("Fill", "libc", measure([&]() { memset(destination.data(), static_cast<int>(length), opaque); }));
+    }
+}
+
+void CPUDispatchBenchmark::run()
+{
+    pmesg("==== BENCHMARK CPU DISPATCH STARTED ====");
+
+    const CPUDispatchTable& table = CPUDispatcher::getTable();
+
+    pmesg("Resolved: LSB = %s; MSB = %s; POP = %s; Copy = %s; Fill = %s.",
+          table.findLeastSignificantBitIndices.variant,
+          table.findMostSignificantBitIndices.variant,
+          table.countSetBits.variant,
+          table.copyMemory.variant,
+          table.fillMemory.variant);
+
+    CPUDispatchBenchmark::benchmarkBitKernels();
+
+    CPUDispatchBenchmark::benchmarkMemoryKernels();
+
+    pmesg("==== BENCHMARK CPU DISPATCH FINISHED ====");
+}
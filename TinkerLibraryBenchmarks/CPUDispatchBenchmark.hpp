@@ -0,0 +1,27 @@
+//
+//  CPUDispatchBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef CPUDispatchBenchmark_hpp
+#define CPUDispatchBenchmark_hpp
+
+#include "TestSuite.hpp"
+
+class CPUDispatchBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Measure the LSB/MSB and population count kernels of each tier supported by the current processor
+    static void benchmarkBitKernels();
+
+    /// Measure the copy and fill kernels of each tier supported by the current processor against the C library
+    static void benchmarkMemoryKernels();
+};
+
+#endif /* CPUDispatchBenchmark_hpp */
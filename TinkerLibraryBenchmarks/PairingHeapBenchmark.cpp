@@ -0,0 +1,103 @@
+//
+//  PairingHeapBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "PairingHeapBenchmark.hpp"
+#include "LinkedList.hpp"
+#include "PairingHeap.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+#include <vector>
+
+/// A task that is scheduled by its virtual runtime
+struct Task: Listable<Task>, Heapable<Task>
+{
+    uint64_t runtime;
+
+    friend bool operator<(const Task& lhs, const Task& rhs)
+    {
+        return lhs.runtime < rhs.runtime;
+    }
+};
+
+void PairingHeapBenchmark::benchmarkHold(size_t numTasks)
+{
+    static constexpr size_t kTrials = 11;
+
+    static constexpr size_t kNumOperations = 4096;
+
+    // Both queues start with the same runtimes and see the same sequence of time slices
+    std::vector<Task> listTasks(numTasks), heapTasks(numTasks);
+
+    LinkedList<Task> list;
+
+    PairingHeap<Task> heap;
+
+    for (size_t index = 0; index < numTasks; index += 1)
+    {
+        listTasks[index].runtime = index * 1000;
+
+        heapTasks[index].runtime = index * 1000;
+
+        list.enqueue(&listTasks[index]);
+
+        heap.push(&heapTasks[index]);
+    }
+
+    // The hold model: Pick the task with the smallest runtime, run it for a random time slice, and queue it again
+    uint32_t listSeed = 2020, heapSeed = 2020;
+
+    Throughput linkedList = ThroughputMeasurer()(kTrials, kNumOperations, [&]()
+    {
+        for (size_t operation = 0; operation < kNumOperations; operation += 1)
+        {
+            listSeed = listSeed * 1103515245 + 12345;
+
+            Task* task = list.dequeue();
+
+            task->runtime += (listSeed >> 8) % (numTasks * 1000);
+
+            list.insert(task, std::less{});
+        }
+
+        return list.peekHead();
+    });
+
+    Throughput pairingHeap = ThroughputMeasurer()(kTrials, kNumOperations, [&]()
+    {
+        for (size_t operation = 0; operation < kNumOperations; operation += 1)
+        {
+            heapSeed = heapSeed * 1103515245 + 12345;
+
+            Task* task = heap.popMin();
+
+            task->runtime += (heapSeed >> 8) % (numTasks * 1000);
+
+            heap.push(task);
+        }
+
+        return heap.peekMin();
+    });
+
+    passert(list.peekHead()->runtime == heap.peekMin()->runtime, "Results mismatched.");
+
+    pmesg("NumTasks = %6lu; Operation = Pop + Push; Linked List = %10.2f ns/op; Pairing Heap = %6.2f ns/op; Speedup = %7.1fx.",
+          numTasks, linkedList.nanosecondsPerOperation, pairingHeap.nanosecondsPerOperation,
+          linkedList.nanosecondsPerOperation / pairingHeap.nanosecondsPerOperation);
+}
+
+void PairingHeapBenchmark::run()
+{
+    pmesg("==== BENCHMARK PAIRING HEAP STARTED ====");
+
+    for (size_t numTasks : {16UL, 128UL, 1024UL, 16384UL})
+    {
+        PairingHeapBenchmark::benchmarkHold(numTasks);
+    }
+
+    pmesg("==== BENCHMARK PAIRING HEAP FINISHED ====");
+}
@@ -0,0 +1,25 @@
+//
+//  PairingHeapBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef PairingHeapBenchmark_hpp
+#define PairingHeapBenchmark_hpp
+
+#include <cstddef>
+#include "TestSuite.hpp"
+
+class PairingHeapBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Compare a pairing heap against a sorted linked list as the run queue of a scheduler that holds the given number of tasks
+    static void benchmarkHold(size_t numTasks);
+};
+
+#endif /* PairingHeapBenchmark_hpp */
@@ -0,0 +1,109 @@
+//
+//  RedBlackTreeBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "RedBlackTreeBenchmark.hpp"
+#include "LinkedList.hpp"
+#include "RedBlackTree.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+#include <vector>
+
+/// A memory region that is keyed by its start address
+struct Region: Listable<Region>, TreeNode<Region>
+{
+    uint64_t start;
+
+    friend bool operator<(const Region& lhs, const Region& rhs)
+    {
+        return lhs.start < rhs.start;
+    }
+
+    friend bool operator<(const Region& lhs, uint64_t rhs)
+    {
+        return lhs.start < rhs;
+    }
+
+    friend bool operator<(uint64_t lhs, const Region& rhs)
+    {
+        return lhs < rhs.start;
+    }
+};
+
+void RedBlackTreeBenchmark::benchmarkLookup(size_t numRegions)
+{
+    static constexpr size_t kTrials = 11;
+
+    static constexpr size_t kNumOperations = 4096;
+
+    // Regions are inserted in a scattered order, so that the list is not built by appending
+    std::vector<Region> regions(numRegions);
+
+    LinkedList<Region> list;
+
+    RedBlackTree<Region> tree;
+
+    for (size_t index = 0; index < numRegions; index += 1)
+    {
+        regions[index].start = ((index * 2654435761) % numRegions) * 0x10000;
+
+        list.insert(&regions[index], std::less{});
+
+        tree.insert(&regions[index]);
+    }
+
+    // Look up the region that starts at a random address
+    uint32_t listSeed = 2020, treeSeed = 2020;
+
+    uint64_t listSum = 0, treeSum = 0;
+
+    Throughput linkedList = ThroughputMeasurer()(kTrials, kNumOperations, [&]()
+    {
+        for (size_t operation = 0; operation < kNumOperations; operation += 1)
+        {
+            listSeed = listSeed * 1103515245 + 12345;
+
+            uint64_t address = ((listSeed >> 8) % numRegions) * 0x10000;
+
+            listSum += list.first([=](const Region* region) -> bool { return region->start == address; })->start;
+        }
+
+        return listSum;
+    });
+
+    Throughput redBlackTree = ThroughputMeasurer()(kTrials, kNumOperations, [&]()
+    {
+        for (size_t operation = 0; operation < kNumOperations; operation += 1)
+        {
+            treeSeed = treeSeed * 1103515245 + 12345;
+
+            uint64_t address = ((treeSeed >> 8) % numRegions) * 0x10000;
+
+            treeSum += tree.find(address)->start;
+        }
+
+        return treeSum;
+    });
+
+    passert(listSum == treeSum, "Results mismatched.");
+
+    pmesg("NumRegions = %6lu; Operation = Lookup; Linked List = %10.2f ns/op; Red Black Tree = %6.2f ns/op; Speedup = %7.1fx.",
+          numRegions, linkedList.nanosecondsPerOperation, redBlackTree.nanosecondsPerOperation,
+          linkedList.nanosecondsPerOperation / redBlackTree.nanosecondsPerOperation);
+}
+
+void RedBlackTreeBenchmark::run()
+{
+    pmesg("==== BENCHMARK RED BLACK TREE STARTED ====");
+
+    for (size_t numRegions : {16UL, 128UL, 1024UL, 16384UL})
+    {
+        RedBlackTreeBenchmark::benchmarkLookup(numRegions);
+    }
+
+    pmesg("==== BENCHMARK RED BLACK TREE FINISHED ====");
+}
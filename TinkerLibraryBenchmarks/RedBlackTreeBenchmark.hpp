@@ -0,0 +1,25 @@
+//
+//  RedBlackTreeBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef RedBlackTreeBenchmark_hpp
+#define RedBlackTreeBenchmark_hpp
+
+#include <cstddef>
+#include "TestSuite.hpp"
+
+class RedBlackTreeBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Compare a red-black tree against a sorted linked list as the region map of an address space that has the given number of regions
+    static void benchmarkLookup(size_t numRegions);
+};
+
+#endif /* RedBlackTreeBenchmark_hpp */
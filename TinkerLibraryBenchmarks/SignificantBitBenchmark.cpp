@@ -0,0 +1,216 @@
+//
+//  SignificantBitBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "SignificantBitBenchmark.hpp"
+#include "SignificantBit.hpp"
+#include "SignificantBitKernels.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+
+/// The number of integers passed to each functor per trial
+static constexpr size_t kNumInputs = 1 << 16;
+
+/// The number of trials for each functor
+static constexpr size_t kTrials = 21;
+
+/// Random inputs shared by all functors
+static uint64_t inputs[kNumInputs];
+
+///
+/// Generate random non-zero inputs whose LSB and MSB are spread across all bit positions of the given type
+///
+/// @tparam T Specify the type of integers passed to the functors
+///
+template <typename T>
+static void generateInputs()
+{
+    uint64_t seed = 2020;
+
+    for (auto& input : inputs)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        // Shift by a random amount, so that the MSB is not always in the top few bits
+        T value = static_cast<T>((seed >> 16) >> ((seed >> 8) % (sizeof(T) * 8)));
+
+        // Move the LSB to a random position
+        value <<= (seed >> 2) % (sizeof(T) * 8);
+
+        input = value != 0 ? value : 1;
+    }
+}
+
+///
+/// Measure the throughput of the given functor on all inputs
+///
+/// @tparam T Specify the type of integers passed to the functor
+/// @tparam Functor Specify the functor under test
+/// @return The throughput of the functor.
+///
+template <typename T, typename Functor>
+static Throughput measure()
+{
+    return ThroughputMeasurer()(kTrials, kNumInputs, []()
+    {
+        uint64_t sum = 0;
+
+        for (uint64_t input : inputs)
+        {
+            sum += Functor()(static_cast<T>(input));
+        }
+
+        return sum;
+    });
+}
+
+template <typename T>
+void SignificantBitBenchmark::benchmarkFinders()
+{
+    generateInputs<T>();
+
+    const std::pair<const char*, std::pair<Throughput, Throughput>> results[] =
+    {
+        { "LSB", { measure<T, LSBFinder<T>>(), measure<T, PortableLSBFinder<T>>() } },
+        { "MSB", { measure<T, MSBFinder<T>>(), measure<T, PortableMSBFinder<T>>() } },
+    };
+
+    for (const auto& [operation, throughputs] : results)
+    {
+        auto [finder, portable] = throughputs;
+
+        pmesg("Width = %2lu; Operation = %s; Finder = %6.2f ns/op (%8.1f Mops/s); Portable = %6.2f ns/op (%8.1f Mops/s).",
+              sizeof(T) * 8, operation,
+              finder.nanosecondsPerOperation, finder.operationsPerSecond / 1e6,
+              portable.nanosecondsPerOperation, portable.operationsPerSecond / 1e6);
+    }
+
+    Throughput popcount = measure<T, PopulationCounter<T>>();
+
+    pmesg("Width = %2lu; Operation = POP; Counter = %6.2f ns/op (%8.1f Mops/s).", sizeof(T) * 8, popcount.nanosecondsPerOperation, popcount.operationsPerSecond / 1e6);
+}
+
+void SignificantBitBenchmark::benchmarkNextPowerOf2()
+{
+    // Leave the top bit clear, so that the next power of 2 is representable
+    generateInputs<uint32_t>();
+
+    for (auto& input : inputs)
+    {
+        input = (input >> 1) | 1;
+    }
+
+    Throughput np2u32 = measure<uint32_t, NextPowerOf2Finder<uint32_t>>();
+
+    generateInputs<uint64_t>();
+
+    for (auto& input : inputs)
+    {
+        input = (input >> 1) | 1;
+    }
+
+    Throughput np2u64 = measure<uint64_t, NextPowerOf2Finder<uint64_t>>();
+
+    pmesg("Width = 32; Operation = NP2; Finder = %6.2f ns/op (%8.1f Mops/s).", np2u32.nanosecondsPerOperation, np2u32.operationsPerSecond / 1e6);
+
+    pmesg("Width = 64; Operation = NP2; Finder = %6.2f ns/op (%8.1f Mops/s).", np2u64.nanosecondsPerOperation, np2u64.operationsPerSecond / 1e6);
+}
+
+template <typename T>
+void SignificantBitBenchmark::benchmarkBatchKernels()
+{
+    static T values[kNumInputs], powers[kNumInputs];
+
+    static uint32_t indices[kNumInputs];
+
+    generateInputs<T>();
+
+    std::copy(inputs, inputs + kNumInputs, values);
+
+    // Inputs to the next power of 2 must be in the range of [1, 2^(N-1)]
+    for (size_t index = 0; index < kNumInputs; index += 1)
+    {
+        powers[index] = static_cast<T>(values[index] >> 1) | 1;
+    }
+
+    auto measureScalar = [](auto&& operation)
+    {
+        return ThroughputMeasurer()(kTrials, kNumInputs, [&]()
+        {
+            for (size_t index = 0; index < kNumInputs; index += 1)
+            {
+                operation(index);
+            }
+
+            return indices[kNumInputs - 1];
+        });
+    };
+
+    auto measureBatch = [](auto&& kernel)
+    {
+        return ThroughputMeasurer()(kTrials, kNumInputs, [&]() { kernel(); return indices[kNumInputs - 1]; });
+    };
+
+    static T results[kNumInputs];
+
+    const std::pair<const char*, std::pair<Throughput, Throughput>> throughputs[] =
+    {
+        {
+            "LSB",
+            {
+                measureScalar([](size_t index) { indices[index] = LSBFinder<T>()(values[index]); }),
+                measureBatch([]() { SignificantBitKernels<T>::findLeastSignificantBitIndices(values, indices, kNumInputs); })
+            }
+        },
+        {
+            "MSB",
+            {
+                measureScalar([](size_t index) { indices[index] = MSBFinder<T>()(values[index]); }),
+                measureBatch([]() { SignificantBitKernels<T>::findMostSignificantBitIndices(values, indices, kNumInputs); })
+            }
+        },
+        {
+            "NP2",
+            {
+                measureScalar([](size_t index) { results[index] = NextPowerOf2Finder<T>()(powers[index]); }),
+                measureBatch([]() { SignificantBitKernels<T>::findNextPowersOf2(powers, results, kNumInputs); })
+            }
+        },
+    };
+
+    for (const auto& [operation, pair] : throughputs)
+    {
+        auto [scalar, batch] = pair;
+
+        pmesg("Width = %2lu; Operation = %s; Scalar = %6.2f ns/op (%8.1f Mops/s); Batch = %6.2f ns/op (%8.1f Mops/s); Speedup = %4.1fx.",
+              sizeof(T) * 8, operation,
+              scalar.nanosecondsPerOperation, scalar.operationsPerSecond / 1e6,
+              batch.nanosecondsPerOperation, batch.operationsPerSecond / 1e6,
+              scalar.nanosecondsPerOperation / batch.nanosecondsPerOperation);
+    }
+}
+
+void SignificantBitBenchmark::run()
+{
+    pmesg("==== BENCHMARK SIGNIFICANT BIT STARTED ====");
+
+    SignificantBitBenchmark::benchmarkFinders<uint8_t>();
+
+    SignificantBitBenchmark::benchmarkFinders<uint16_t>();
+
+    SignificantBitBenchmark::benchmarkFinders<uint32_t>();
+
+    SignificantBitBenchmark::benchmarkFinders<uint64_t>();
+
+    SignificantBitBenchmark::benchmarkNextPowerOf2();
+
+    SignificantBitBenchmark::benchmarkBatchKernels<uint32_t>();
+
+    SignificantBitBenchmark::benchmarkBatchKernels<uint64_t>();
+
+    pmesg("==== BENCHMARK SIGNIFICANT BIT FINISHED ====");
+}
@@ -0,0 +1,32 @@
+//
+//  SignificantBitBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef SignificantBitBenchmark_hpp
+#define SignificantBitBenchmark_hpp
+
+#include "TestSuite.hpp"
+
+class SignificantBitBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Measure the LSB/MSB finders and the population counter on integers of the given type against the portable implementation
+    template <typename T>
+    static void benchmarkFinders();
+
+    /// Measure the next power of 2 finder on 32-bit and 64-bit integers
+    static void benchmarkNextPowerOf2();
+
+    /// Measure the batch kernels on arrays of integers of the given type against a loop over the scalar finders
+    template <typename T>
+    static void benchmarkBatchKernels();
+};
+
+#endif /* SignificantBitBenchmark_hpp */
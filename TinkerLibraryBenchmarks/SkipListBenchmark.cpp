@@ -0,0 +1,136 @@
+//
+//  SkipListBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "SkipListBenchmark.hpp"
+#include "LinkedList.hpp"
+#include "SkipList.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+#include <algorithm>
+#include <vector>
+
+/// A timer in a linked list
+struct ListTimer: Listable<ListTimer>
+{
+    uint64_t deadline;
+
+    friend bool operator<(const ListTimer& lhs, const ListTimer& rhs)
+    {
+        return lhs.deadline < rhs.deadline;
+    }
+};
+
+/// A timer in a skip list, which has enough levels for a million timers
+struct SkipListTimer: SkipListable<SkipListTimer, 10>
+{
+    uint64_t deadline;
+
+    friend bool operator<(const SkipListTimer& lhs, const SkipListTimer& rhs)
+    {
+        return lhs.deadline < rhs.deadline;
+    }
+};
+
+void SkipListBenchmark::benchmarkInsertAndRemove(size_t numTimers)
+{
+    static constexpr size_t kTrials = 11;
+
+    static constexpr size_t kNumOperations = 1024;
+
+    // Timers are allocated in a different order than their deadlines, as in a timer queue
+    std::vector<ListTimer> listTimers(numTimers + kNumOperations);
+
+    std::vector<SkipListTimer> skipListTimers(numTimers + kNumOperations);
+
+    uint64_t seed = 2020;
+
+    for (size_t index = 0; index < numTimers + kNumOperations; index += 1)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        listTimers[index].deadline = seed >> 16;
+
+        skipListTimers[index].deadline = seed >> 16;
+    }
+
+    // The linked list is filled in sorted order, because filling it with sorted insertions takes quadratic time
+    LinkedList<ListTimer> list;
+
+    std::vector<ListTimer*> sorted(numTimers);
+
+    for (size_t index = 0; index < numTimers; index += 1)
+    {
+        sorted[index] = &listTimers[index];
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](const ListTimer* lhs, const ListTimer* rhs) { return *lhs < *rhs; });
+
+    for (ListTimer* timer : sorted)
+    {
+        list.enqueue(timer);
+    }
+
+    SkipList<SkipListTimer> skipList;
+
+    for (size_t index = 0; index < numTimers; index += 1)
+    {
+        skipList.insert(&skipListTimers[index]);
+    }
+
+    // Insert and then cancel each extra timer, which leaves the lists unchanged after each trial
+    // The linked list visits half of its timers per insertion on average, so large lists are measured with fewer operations
+    size_t numListOperations = std::clamp<size_t>((1 << 24) / numTimers, 16, kNumOperations);
+
+    Throughput linkedList = ThroughputMeasurer()(kTrials, numListOperations, [&]()
+    {
+        for (size_t index = numTimers; index < numTimers + numListOperations; index += 1)
+        {
+            list.insert(&listTimers[index], std::less{});
+
+            list.remove(&listTimers[index]);
+        }
+
+        return list.peekHead();
+    });
+
+    Throughput skipListInsert = ThroughputMeasurer()(kTrials, kNumOperations, [&]()
+    {
+        for (size_t index = numTimers; index < numTimers + kNumOperations; index += 1)
+        {
+            skipList.insert(&skipListTimers[index]);
+
+            skipList.remove(&skipListTimers[index]);
+        }
+
+        return skipList.peekHead();
+    });
+
+    // Both lists must agree on the order
+    passert(list.getCount() == numTimers && skipList.getCount() == numTimers, "Count: Results mismatched.");
+
+    for (size_t index = 0; index < numTimers; index += 1)
+    {
+        passert(list.dequeue()->deadline == skipList.dequeue()->deadline, "Order: Results mismatched at %lu.", index);
+    }
+
+    pmesg("NumTimers = %7lu; Operation = Insert + Remove; Linked List = %12.2f ns/op; Skip List = %8.2f ns/op; Speedup = %8.1fx.",
+          numTimers, linkedList.nanosecondsPerOperation, skipListInsert.nanosecondsPerOperation,
+          linkedList.nanosecondsPerOperation / skipListInsert.nanosecondsPerOperation);
+}
+
+void SkipListBenchmark::run()
+{
+    pmesg("==== BENCHMARK SKIP LIST STARTED ====");
+
+    for (size_t numTimers : {1000UL, 10000UL, 100000UL, 1000000UL})
+    {
+        SkipListBenchmark::benchmarkInsertAndRemove(numTimers);
+    }
+
+    pmesg("==== BENCHMARK SKIP LIST FINISHED ====");
+}
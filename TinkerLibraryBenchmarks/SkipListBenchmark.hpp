@@ -0,0 +1,25 @@
+//
+//  SkipListBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef SkipListBenchmark_hpp
+#define SkipListBenchmark_hpp
+
+#include <cstddef>
+#include "TestSuite.hpp"
+
+class SkipListBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Compare the sorted insertion and the removal of a skip list against a linked list that holds the given number of timers
+    static void benchmarkInsertAndRemove(size_t numTimers);
+};
+
+#endif /* SkipListBenchmark_hpp */
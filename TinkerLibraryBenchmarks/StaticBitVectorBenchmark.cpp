@@ -0,0 +1,528 @@
+//
+//  StaticBitVectorBenchmark.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "StaticBitVectorBenchmark.hpp"
+#include "StaticBitVector.hpp"
+#include "StaticBitVectorCountingIndex.hpp"
+#include "Experiments.hpp"
+#include "Debug.hpp"
+
+/// The number of bits in the vector under test
+static constexpr size_t kNumBits = 1 << 20;
+
+/// The vector under test, which is too large to live on the stack
+static StaticBitVector<kNumBits> vector;
+
+/// Another vector of the same size that serves as the mask in bitwise operations
+static StaticBitVector<kNumBits> mask;
+
+///
+/// Find the first run of consecutive zero bits by examining one bit at a time
+///
+/// @param count The number of consecutive zero bits
+/// @param alignment Specify the alignment of the index of the first bit in the run
+/// @return The index of the first bit in the run on success, `-1` if no such run exists.
+///
+static ssize_t findContiguousZeroRunBitByBit(size_t count, size_t alignment)
+{
+    size_t start = 0, length = 0;
+
+    for (size_t index = 0; index < kNumBits; index += 1)
+    {
+        if (vector.getBit(index) != 0)
+        {
+            length = 0;
+
+            continue;
+        }
+
+        // Guard: A new run must start at an aligned index
+        if (length == 0)
+        {
+            if (index % alignment != 0)
+            {
+                continue;
+            }
+
+            start = index;
+        }
+
+        length += 1;
+
+        if (length == count)
+        {
+            return static_cast<ssize_t>(start);
+        }
+    }
+
+    return -1;
+}
+
+void StaticBitVectorBenchmark::benchmarkContiguousZeroRun()
+{
+    // Simulate a fragmented free map: Alternate free runs of 1 to 32 bits and used runs of 1 to 16 bits
+    vector.initWithZeros();
+
+    uint32_t seed = 2020;
+
+    for (size_t index = 0; index < kNumBits;)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        index += (seed >> 8) % 32 + 1;
+
+        size_t used = (seed >> 20) % 16 + 1;
+
+        if (index < kNumBits)
+        {
+            vector.setRange(index, std::min(used, kNumBits - index));
+        }
+
+        index += used;
+    }
+
+    // Only the last quarter of the vector has a large free region
+    vector.clearRange(kNumBits / 4 * 3, 4096);
+
+    static constexpr size_t kTrials = 11;
+
+    static constexpr size_t kRuns[][2] =
+    {
+        // Count, Alignment
+        {    8,  1 },
+        {   24,  1 },
+        {   24,  8 },
+        {   32,  1 },
+        {  512,  1 },
+        { 4096, 64 },
+        { 8192,  1 },
+    };
+
+    for (const auto& run : kRuns)
+    {
+        size_t count = run[0], alignment = run[1];
+
+        auto [naive, expected] = ExecutionTimeMeasurerWithResult()(kTrials, findContiguousZeroRunBitByBit, count, alignment);
+
+        auto [fast, actual] = ExecutionTimeMeasurerWithResult()(kTrials, [&]() { return vector.findContiguousZeroRun(count, alignment); });
+
+        passert(expected == actual, "Run = %lu; Alignment = %lu: Results mismatched (%ld vs %ld).", count, alignment, expected, actual);
+
+        pmesg("Run = %4lu; Alignment = %2lu; Found @ %8ld; Bit-by-Bit = %10llu ns; Word-Level = %8llu ns; Speedup = %7.1fx.",
+              count, alignment, actual,
+              static_cast<unsigned long long>(naive), static_cast<unsigned long long>(fast),
+              static_cast<double>(naive) / static_cast<double>(fast == 0 ? 1 : fast));
+    }
+}
+
+void StaticBitVectorBenchmark::benchmarkBitwiseAlgebra()
+{
+    // The vector has every other bit set, while the mask has every fourth bit set
+    vector.initWithZeros();
+
+    mask.initWithZeros();
+
+    for (size_t index = 0; index < kNumBits; index += 2)
+    {
+        vector.setBit(index);
+
+        if (index % 4 == 0)
+        {
+            mask.setBit(index);
+        }
+    }
+
+    static constexpr size_t kTrials = 11;
+
+    // Intersect the vector with the mask, which leaves the vector unchanged after the first trial
+    auto [naiveAnd, expected] = ExecutionTimeMeasurerWithResult()(kTrials, [&]()
+    {
+        for (size_t index = 0; index < kNumBits; index += 1)
+        {
+            if (!mask.containsBit(index))
+            {
+                vector.clearBit(index);
+            }
+        }
+
+        return vector.count();
+    });
+
+    vector.initWithZeros();
+
+    for (size_t index = 0; index < kNumBits; index += 2)
+    {
+        vector.setBit(index);
+    }
+
+    auto [fastAnd, actual] = ExecutionTimeMeasurerWithResult()(kTrials, [&]() { vector &= mask; return vector.count(); });
+
+    passert(expected == actual, "AND: Results mismatched (%lu vs %lu).", expected, actual);
+
+    // Check whether the mask is a subset of the vector, which requires examining every bit
+    auto [naiveSubset, isSubsetExpected] = ExecutionTimeMeasurerWithResult()(kTrials, [&]()
+    {
+        for (size_t index = 0; index < kNumBits; index += 1)
+        {
+            if (mask.containsBit(index) && !vector.containsBit(index))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    });
+
+    auto [fastSubset, isSubset] = ExecutionTimeMeasurerWithResult()(kTrials, [&]() { return mask.isSubsetOf(vector); });
+
+    passert(isSubset && isSubsetExpected, "Subset: Results mismatched.");
+
+    // The vectors have a single bit in common at the end
+    vector.initWithZeros();
+
+    vector.setBit(kNumBits - 1);
+
+    mask.setBit(kNumBits - 1);
+
+    auto [naiveIntersect, intersectsExpected] = ExecutionTimeMeasurerWithResult()(kTrials, [&]()
+    {
+        for (size_t index = 0; index < kNumBits; index += 1)
+        {
+            if (mask.containsBit(index) && vector.containsBit(index))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    });
+
+    auto [fastIntersect, intersects] = ExecutionTimeMeasurerWithResult()(kTrials, [&]() { return mask.intersects(vector); });
+
+    passert(intersects && intersectsExpected, "Intersect: Results mismatched.");
+
+    const std::pair<const char*, std::pair<uint64_t, uint64_t>> results[] =
+    {
+        { "AND",       { naiveAnd,       fastAnd       } },
+        { "Subset",    { naiveSubset,    fastSubset    } },
+        { "Intersect", { naiveIntersect, fastIntersect } },
+    };
+
+    for (const auto& [operation, timings] : results)
+    {
+        auto [naive, fast] = timings;
+
+        pmesg("Operation = %-9s; Bit-by-Bit = %10llu ns; Word-Level = %8llu ns; Speedup = %7.1fx.",
+              operation, static_cast<unsigned long long>(naive), static_cast<unsigned long long>(fast),
+              static_cast<double>(naive) / static_cast<double>(fast == 0 ? 1 : fast));
+    }
+}
+
+void StaticBitVectorBenchmark::benchmarkCountingIndex()
+{
+    // Simulate a frame map under memory pressure: About 90% of the frames are used, and only the last window has most of its frames free
+    vector.initWithZeros();
+
+    uint32_t seed = 2020;
+
+    for (size_t index = 0; index < kNumBits; index += 1)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        if ((seed >> 16) % 10 != 0)
+        {
+            vector.setBit(index);
+        }
+    }
+
+    static constexpr size_t kWindowLength = 32768;
+
+    vector.clearRange(kNumBits - kWindowLength, kWindowLength);
+
+    static StaticBitVectorCountingIndex<kNumBits> index(vector);
+
+    index.rebuild();
+
+    static constexpr size_t kTrials = 11;
+
+    static constexpr size_t kNumQueries = 1024;
+
+    // Random ranges and ranks: Lower Bound, Upper Bound, K
+    static size_t queries[kNumQueries][3];
+
+    for (auto& query : queries)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        size_t lowerBound = (seed >> 4) % kNumBits;
+
+        seed = seed * 1103515245 + 12345;
+
+        query[0] = lowerBound;
+
+        query[1] = lowerBound + (seed >> 4) % (kNumBits - lowerBound);
+
+        query[2] = (seed >> 8) % index.count();
+    }
+
+    Throughput scanRange = ThroughputMeasurer()(kTrials, kNumQueries, []()
+    {
+        size_t sum = 0;
+
+        for (const auto& query : queries)
+        {
+            sum += vector.rank(query[1] + 1) - vector.rank(query[0]);
+        }
+
+        return sum;
+    });
+
+    Throughput indexRange = ThroughputMeasurer()(kTrials, kNumQueries, []()
+    {
+        size_t sum = 0;
+
+        for (const auto& query : queries)
+        {
+            sum += index.countWithRange(ClosedRange<size_t>(query[0], query[1]));
+        }
+
+        return sum;
+    });
+
+    Throughput scanSelect = ThroughputMeasurer()(kTrials, kNumQueries, []()
+    {
+        ssize_t sum = 0;
+
+        for (const auto& query : queries)
+        {
+            sum += vector.select(query[2]);
+        }
+
+        return sum;
+    });
+
+    Throughput indexSelect = ThroughputMeasurer()(kTrials, kNumQueries, []()
+    {
+        ssize_t sum = 0;
+
+        for (const auto& query : queries)
+        {
+            sum += index.select(query[2]);
+        }
+
+        return sum;
+    });
+
+    // Find the first window that has at least half of its frames free, which counts each window with two scans
+    auto [scanWindow, expected] = ExecutionTimeMeasurerWithResult()(kTrials, []()
+    {
+        for (size_t start = 0; start < kNumBits; start += kWindowLength)
+        {
+            if (kWindowLength - (vector.rank(start + kWindowLength) - vector.rank(start)) >= kWindowLength / 2)
+            {
+                return static_cast<ssize_t>(start);
+            }
+        }
+
+        return static_cast<ssize_t>(-1);
+    });
+
+    auto [indexWindow, actual] = ExecutionTimeMeasurerWithResult()(kTrials, []() { return index.findFirstWindowWithZeroBits(kWindowLength, kWindowLength / 2); });
+
+    passert(expected == actual, "Window: Results mismatched (%ld vs %ld).", expected, actual);
+
+    // Keeping the index in sync costs a logarithmic number of stores per modification
+    Throughput plainUpdate = ThroughputMeasurer()(kTrials, kNumQueries * 2, []()
+    {
+        for (const auto& query : queries)
+        {
+            vector.clearBit(query[0]);
+
+            vector.setBit(query[0]);
+        }
+
+        return vector.containsBit(queries[0][0]);
+    });
+
+    Throughput indexUpdate = ThroughputMeasurer()(kTrials, kNumQueries * 2, []()
+    {
+        for (const auto& query : queries)
+        {
+            index.clearBit(query[0]);
+
+            index.setBit(query[0]);
+        }
+
+        return vector.containsBit(queries[0][0]);
+    });
+
+    const std::pair<const char*, std::pair<double, double>> results[] =
+    {
+        { "Range Count", { scanRange.nanosecondsPerOperation,  indexRange.nanosecondsPerOperation  } },
+        { "Select",      { scanSelect.nanosecondsPerOperation, indexSelect.nanosecondsPerOperation } },
+        { "Window",      { static_cast<double>(scanWindow),    static_cast<double>(indexWindow)    } },
+        { "Update",      { plainUpdate.nanosecondsPerOperation, indexUpdate.nanosecondsPerOperation } },
+    };
+
+    for (const auto& [operation, timings] : results)
+    {
+        auto [scan, indexed] = timings;
+
+        pmesg("Operation = %-11s; Scan = %12.2f ns/op; Index = %8.2f ns/op; Speedup = %7.1fx.", operation, scan, indexed, scan / indexed);
+    }
+}
+
+template <size_t NumBits, typename StorageUnit>
+void StaticBitVectorBenchmark::benchmarkSearches()
+{
+    // Vectors of the largest size are too large to live on the stack
+    static StaticBitVector<NumBits, StorageUnit> bits;
+
+    static constexpr size_t kTrials = 11;
+
+    static constexpr size_t kNumRanges = 1024;
+
+    static constexpr size_t kDensities[] = { 1, 50, 99 };
+
+    // Random ranges of up to 4096 bits within the vector: Lower Bound, Upper Bound
+    static size_t ranges[kNumRanges][2];
+
+    uint32_t seed = 2020;
+
+    for (auto& range : ranges)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        size_t lowerBound = (seed >> 4) % NumBits;
+
+        size_t length = (seed >> 16) % std::min<size_t>(4096, NumBits - lowerBound);
+
+        range[0] = lowerBound;
+
+        range[1] = lowerBound + length;
+    }
+
+    for (size_t density : kDensities)
+    {
+        // Set each bit with the given probability in percent
+        bits.initWithZeros();
+
+        for (size_t index = 0; index < NumBits; index += 1)
+        {
+            seed = seed * 1103515245 + 12345;
+
+            if ((seed >> 16) % 100 < density)
+            {
+                bits.setBit(index);
+            }
+        }
+
+        size_t numSetBits = bits.count();
+
+        // Visit each set bit or zero bit in turn, which is measured per bit found
+        Throughput nextSet = ThroughputMeasurer()(kTrials, numSetBits, []()
+        {
+            size_t sum = 0;
+
+            for (ssize_t index = bits.findNextSetBit(0); index >= 0; index = bits.findNextSetBit(index + 1))
+            {
+                sum += index;
+            }
+
+            return sum;
+        });
+
+        Throughput nextZero = ThroughputMeasurer()(kTrials, NumBits - numSetBits, []()
+        {
+            size_t sum = 0;
+
+            for (ssize_t index = bits.findNextZeroBit(0); index >= 0; index = bits.findNextZeroBit(index + 1))
+            {
+                sum += index;
+            }
+
+            return sum;
+        });
+
+        // Search each random range once, which is measured per range
+        Throughput rangeLSB = ThroughputMeasurer()(kTrials, kNumRanges, []()
+        {
+            ssize_t sum = 0;
+
+            for (const auto& range : ranges)
+            {
+                sum += bits.findLeastSignificantBitIndexWithRange(ClosedRange<size_t>(range[0], range[1]));
+            }
+
+            return sum;
+        });
+
+        Throughput rangeMSB = ThroughputMeasurer()(kTrials, kNumRanges, []()
+        {
+            ssize_t sum = 0;
+
+            for (const auto& range : ranges)
+            {
+                sum += bits.findMostSignificantBitIndexWithRange(ClosedRange<size_t>(range[0], range[1]));
+            }
+
+            return sum;
+        });
+
+        Throughput rangeZero = ThroughputMeasurer()(kTrials, kNumRanges, []()
+        {
+            ssize_t sum = 0;
+
+            for (const auto& range : ranges)
+            {
+                sum += bits.findFirstZeroBitIndexWithRange(ClosedRange<size_t>(range[0], range[1]));
+            }
+
+            return sum;
+        });
+
+        const std::pair<const char*, Throughput> results[] =
+        {
+            { "Next Set",   nextSet   },
+            { "Next Zero",  nextZero  },
+            { "Range LSB",  rangeLSB  },
+            { "Range MSB",  rangeMSB  },
+            { "Range Zero", rangeZero },
+        };
+
+        for (const auto& [operation, throughput] : results)
+        {
+            pmesg("Size = %7lu; Unit = %3lu bits; Density = %2lu%%; Operation = %-10s; %8.2f ns/op (%8.2f Mops/s).",
+                  NumBits, sizeof(StorageUnit) * 8, density, operation, throughput.nanosecondsPerOperation, throughput.operationsPerSecond / 1e6);
+        }
+    }
+}
+
+void StaticBitVectorBenchmark::run()
+{
+    pmesg("==== BENCHMARK STATIC BIT VECTOR STARTED ====");
+
+    StaticBitVectorBenchmark::benchmarkContiguousZeroRun();
+
+    StaticBitVectorBenchmark::benchmarkBitwiseAlgebra();
+
+    StaticBitVectorBenchmark::benchmarkCountingIndex();
+
+    StaticBitVectorBenchmark::benchmarkSearches<4096>();
+
+    StaticBitVectorBenchmark::benchmarkSearches<65536>();
+
+    // Wider storage units visit fewer blocks per search
+    StaticBitVectorBenchmark::benchmarkSearches<65536, UInt128>();
+
+    StaticBitVectorBenchmark::benchmarkSearches<65536, UInt256>();
+
+    StaticBitVectorBenchmark::benchmarkSearches<kNumBits>();
+
+    pmesg("==== BENCHMARK STATIC BIT VECTOR FINISHED ====");
+}
@@ -0,0 +1,35 @@
+//
+//  StaticBitVectorBenchmark.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef StaticBitVectorBenchmark_hpp
+#define StaticBitVectorBenchmark_hpp
+
+#include <cstddef>
+#include "TestSuite.hpp"
+
+class StaticBitVectorBenchmark: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Compare the word-level search for a run of zero bits against a bit-by-bit search on a 1M-bit vector
+    static void benchmarkContiguousZeroRun();
+
+    /// Compare the whole-vector bitwise operators against per-bit loops on 1M-bit vectors
+    static void benchmarkBitwiseAlgebra();
+
+    /// Compare the counting index against the linear scans of a 1M-bit vector for range counts, selections and window searches
+    static void benchmarkCountingIndex();
+
+    /// Measure the searches for set bits, zero bits and bits in random ranges on a vector of the given size and storage unit at several fill densities
+    template <size_t NumBits, typename StorageUnit = size_t>
+    static void benchmarkSearches();
+};
+
+#endif /* StaticBitVectorBenchmark_hpp */
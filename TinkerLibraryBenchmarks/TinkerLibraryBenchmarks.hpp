@@ -0,0 +1,23 @@
+//
+//  TinkerLibraryBenchmarks.hpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//
+
+#ifndef TinkerLibraryBenchmarks_hpp
+#define TinkerLibraryBenchmarks_hpp
+
+// Umbrella Header
+
+#include "AtomicStaticBitVectorBenchmark.hpp"
+#include "BitMatrixBenchmark.hpp"
+#include "BitOptionsBenchmark.hpp"
+#include "CPUDispatchBenchmark.hpp"
+#include "PairingHeapBenchmark.hpp"
+#include "RedBlackTreeBenchmark.hpp"
+#include "SignificantBitBenchmark.hpp"
+#include "SkipListBenchmark.hpp"
+#include "StaticBitVectorBenchmark.hpp"
+
+#endif /* TinkerLibraryBenchmarks_hpp */
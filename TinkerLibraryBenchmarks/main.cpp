@@ -0,0 +1,43 @@
+//
+//  main.cpp
+//  TinkerLibraryBenchmarks
+//
+//  Created by FireWolf on 10/17/26.
+//
+
+#include "TinkerLibraryBenchmarks.hpp"
+#include <TestSuite.hpp>
+#include <Debug.hpp>
+
+static AtomicStaticBitVectorBenchmark atomicStaticBitVectorBenchmark;
+static BitMatrixBenchmark bitMatrixBenchmark;
+static BitOptionsBenchmark bitOptionsBenchmark;
+static CPUDispatchBenchmark cpuDispatchBenchmark;
+static PairingHeapBenchmark pairingHeapBenchmark;
+static RedBlackTreeBenchmark redBlackTreeBenchmark;
+static SignificantBitBenchmark significantBitBenchmark;
+static SkipListBenchmark skipListBenchmark;
+static StaticBitVectorBenchmark staticBitVectorBenchmark;
+
+static TestSuite* benchmarks[] =
+{
+    &atomicStaticBitVectorBenchmark,
+    &bitMatrixBenchmark,
+    &bitOptionsBenchmark,
+    &cpuDispatchBenchmark,
+    &pairingHeapBenchmark,
+    &redBlackTreeBenchmark,
+    &significantBitBenchmark,
+    &skipListBenchmark,
+    &staticBitVectorBenchmark
+};
+
+int main()
+{
+    for (auto benchmark : benchmarks)
+    {
+        benchmark->run();
+    }
+
+    return 0;
+}
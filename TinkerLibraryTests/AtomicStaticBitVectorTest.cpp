@@ -0,0 +1,144 @@
+//
+//  AtomicStaticBitVectorTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "AtomicStaticBitVectorTest.hpp"
+#include "AtomicStaticBitVector.hpp"
+#include <thread>
+#include <vector>
+
+void AtomicStaticBitVectorTest::run()
+{
+    pinfof("==== TEST ATOMIC STATIC BIT VECTOR STARTED ====\n");
+
+    // Test Test-and-Set / Test-and-Clear
+    AtomicStaticBitVector<12, uint8_t> vector;
+
+    vector.initWithZeros();
+
+    passert(!vector.testAndSet(3), "Set a clear bit.");
+
+    passert(vector.testAndSet(3), "Set a set bit.");
+
+    passert(vector.containsBit(3) && vector.blocks[0] == 0x08, "Check the raw value of block 0 after set.");
+
+    passert(vector.testAndClear(3), "Clear a set bit.");
+
+    passert(!vector.testAndClear(3), "Clear a clear bit.");
+
+    passert(!vector.testAndSet(12) && !vector.testAndClear(12) && !vector.containsBit(12), "Invalid index.");
+
+    vector.initWithOnes();
+
+    passert(vector.blocks[0] == 0xFF && vector.blocks[1] == 0x0F && vector.count() == 12, "Init with ones.");
+
+    pinfo("Test-and-Set/Clear: Test Passed.");
+
+    // Test Claim
+    passert(vector.claimFirstZero() == -1, "Claim from a full vector.");
+
+    passert(vector.testAndClear(5) && vector.testAndClear(10), "Clear bits 5 and 10.");
+
+    passert(vector.claimFirstZero() == 5, "Claim without a hint.");
+
+    passert(vector.claimFirstZero(8) == 10, "Claim with a hint.");
+
+    passert(vector.testAndClear(2), "Clear bit 2.");
+
+    passert(vector.claimFirstZero(9) == 2, "Claim wraps around.");
+
+    passert(vector.claimFirstZero(100) == -1, "Claim with an out-of-bounds hint.");
+
+    vector.initWithZeros();
+
+    // The search starts at block 1 and then wraps around to block 0
+    for (size_t index = 0; index < 12; index += 1)
+    {
+        passert(vector.claimFirstZero(11) == static_cast<ssize_t>(index < 4 ? index + 8 : index - 4), "Claim the %lu-th bit.", index);
+    }
+
+    passert(vector.claimFirstZero(11) == -1, "Never claim nonexistent bits.");
+
+    pinfo("Claim: Test Passed.");
+
+    // Test Concurrent Claim: Every bit is claimed by exactly one thread
+    static AtomicStaticBitVector<4096> shared;
+
+    static constexpr size_t kNumThreads = 8;
+
+    shared.initWithZeros();
+
+    std::vector<ssize_t> claims[kNumThreads];
+
+    std::vector<std::thread> threads;
+
+    for (size_t thread = 0; thread < kNumThreads; thread += 1)
+    {
+        threads.emplace_back([&claims, thread]() -> void
+        {
+            ssize_t index;
+
+            // Start from the region of the current thread, and then steal bits from other regions
+            while ((index = shared.claimFirstZero(thread * 4096 / kNumThreads)) >= 0)
+            {
+                claims[thread].push_back(index);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<size_t> owners(4096, 0);
+
+    for (const auto& claim : claims)
+    {
+        for (ssize_t index : claim)
+        {
+            owners[index] += 1;
+        }
+    }
+
+    for (size_t index = 0; index < 4096; index += 1)
+    {
+        passert(owners[index] == 1, "Bit %lu is claimed %lu times.", index, owners[index]);
+    }
+
+    passert(shared.count() == 4096, "All bits are set after concurrent claims.");
+
+    // Release bits concurrently: Every bit is released by exactly one thread
+    std::atomic<size_t> numReleased = 0;
+
+    threads.clear();
+
+    for (size_t thread = 0; thread < kNumThreads; thread += 1)
+    {
+        threads.emplace_back([&numReleased]() -> void
+        {
+            for (size_t index = 0; index < 4096; index += 1)
+            {
+                if (shared.testAndClear(index))
+                {
+                    numReleased.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    passert(numReleased.load() == 4096 && shared.count() == 0, "Every bit is released exactly once.");
+
+    pinfo("Concurrent Claim/Release: Test Passed.");
+
+    pinfof("==== TEST ATOMIC STATIC BIT VECTOR FINISHED ====\n");
+}
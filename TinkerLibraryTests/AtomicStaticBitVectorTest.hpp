@@ -0,0 +1,20 @@
+//
+//  AtomicStaticBitVectorTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef AtomicStaticBitVectorTest_hpp
+#define AtomicStaticBitVectorTest_hpp
+
+#include "TestSuite.hpp"
+
+class AtomicStaticBitVectorTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* AtomicStaticBitVectorTest_hpp */
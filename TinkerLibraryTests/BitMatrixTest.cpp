@@ -0,0 +1,138 @@
+//
+//  BitMatrixTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "BitMatrixTest.hpp"
+#include "BitMatrix.hpp"
+#include "Debug.hpp"
+
+///
+/// Verify the evaluation, counting and searches of the given expression against a bit-by-bit evaluation
+///
+/// @param matrix A bit matrix
+/// @param expression An expression on the rows of the matrix
+/// @param reference A functor that takes a bit index and returns the value of the expression at that index
+/// @param name The name of the expression
+///
+template <typename Matrix, typename Expression, typename Reference>
+static void testExpression(const Matrix& matrix, const Expression& expression, Reference reference, const char* name)
+{
+    static typename Matrix::Row result;
+
+    passert(matrix.evaluate(expression, result), "%s: Evaluate.", name);
+
+    size_t count = 0;
+
+    ssize_t next = -1;
+
+    // Walk the bits backwards, so that the next set bit from each index is known
+    for (size_t index = Matrix::getNumBits(); index-- > 0;)
+    {
+        bool expected = reference(index);
+
+        passert(result.containsBit(index) == expected, "%s: Bit %lu.", name, index);
+
+        if (expected)
+        {
+            count += 1;
+
+            next = static_cast<ssize_t>(index);
+        }
+
+        passert(matrix.findNextSetBit(expression, index) == next, "%s: Next set bit from %lu.", name, index);
+    }
+
+    passert(matrix.count(expression) == count && result.count() == count, "%s: Count.", name);
+
+    passert(matrix.findFirstSetBit(expression) == next, "%s: First set bit.", name);
+}
+
+///
+/// Verify a bit matrix of the given storage unit whose rows do not fill the last block
+///
+template <typename StorageUnit>
+static void testBitMatrix()
+{
+    static constexpr size_t kNumBits = 1000;
+
+    static BitMatrix<4, kNumBits, StorageUnit> matrix;
+
+    // Random rows of different densities, where the last row is sparse
+    for (size_t row = 0; row < matrix.getNumRows(); row += 1)
+    {
+        matrix.getRow(row).initWithZeros();
+
+        for (size_t index = 0; index < kNumBits; index += 1)
+        {
+            if (rand() % (row + 2) == 0 && (row != 3 || index % 97 == 0))
+            {
+                matrix.getRow(row).setBit(index);
+            }
+        }
+    }
+
+    BitMatrixRow a(0), b(1), c(2), d(3);
+
+    auto bit = [&](size_t row, size_t index) -> bool { return matrix.getRow(row).containsBit(index); };
+
+    testExpression(matrix, a, [&](size_t index) { return bit(0, index); }, "A");
+
+    testExpression(matrix, ~a, [&](size_t index) { return !bit(0, index); }, "~A");
+
+    testExpression(matrix, (a & b) | ~c, [&](size_t index) { return (bit(0, index) && bit(1, index)) || !bit(2, index); }, "(A & B) | ~C");
+
+    testExpression(matrix, a ^ b ^ c, [&](size_t index) { return bit(0, index) ^ bit(1, index) ^ bit(2, index); }, "A ^ B ^ C");
+
+    testExpression(matrix, d & ~(a | b), [&](size_t index) { return bit(3, index) && !(bit(0, index) || bit(1, index)); }, "D & ~(A | B)");
+
+    testExpression(matrix, a & ~a, [](size_t) { return false; }, "A & ~A");
+
+    testExpression(matrix, a | ~a, [](size_t) { return true; }, "A | ~A");
+
+    // Searches beyond the last bit
+    passert(matrix.findNextSetBit(a | ~a, kNumBits) == -1, "Search beyond the last bit.");
+
+    // Rows remain intact
+    passert(matrix.getRow(3).count() == matrix.count(d), "Rows remain intact.");
+
+    pinfo("Storage Unit = %3lu bits: Test Passed.", sizeof(StorageUnit) * 8);
+}
+
+void BitMatrixTest::run()
+{
+    pinfof("==== TEST BIT MATRIX STARTED ====\n");
+
+    testBitMatrix<uint8_t>();
+
+    testBitMatrix<uint32_t>();
+
+    testBitMatrix<uint64_t>();
+
+    testBitMatrix<UInt128>();
+
+    testBitMatrix<UInt256>();
+
+    // An expression that refers to a row that does not exist yields an empty result
+    BitMatrix<2, 64> matrix;
+
+    matrix.getRow(0).initWithOnes();
+
+    BitMatrixRow a(0), missing(2);
+
+    BitMatrix<2, 64>::Row result;
+
+    passert(matrix.findFirstSetBit(a | missing) == -1 && matrix.count(a | missing) == 0 && !matrix.evaluate(a | missing, result), "Invalid Expression.");
+
+    passert(matrix.findFirstSetBit(a) == 0 && matrix.count(a) == 64, "Valid Expression.");
+
+    // The result may be one of the rows
+    passert(matrix.evaluate(~a, matrix.getRow(0)) && matrix.getRow(0).count() == 0, "Evaluate in place.");
+
+    pinfo("Invalid Expressions: Test Passed.");
+
+    pinfof("==== TEST BIT MATRIX FINISHED ====\n");
+}
@@ -0,0 +1,20 @@
+//
+//  BitMatrixTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef BitMatrixTest_hpp
+#define BitMatrixTest_hpp
+
+#include "TestSuite.hpp"
+
+class BitMatrixTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* BitMatrixTest_hpp */
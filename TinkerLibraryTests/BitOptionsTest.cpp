@@ -8,8 +8,111 @@
 
 #include "BitOptionsTest.hpp"
 #include "BitOptions.hpp"
+#include "BitFlags.hpp"
 #include "Debug.hpp"
 
+/// Flags used to test `BitFlags`
+enum class TestFlag
+{
+    Read,
+    Write,
+    Execute,
+    Shared,
+    Locked,
+    Dirty,
+    Accessed,
+    Global,
+    Huge,
+    MaxValue = Huge
+};
+
+/// The sum of the indices of the given flags, which must be evaluated at compile time
+static consteval size_t sumOfFlags(BitFlags<TestFlag> flags)
+{
+    size_t sum = 0;
+
+    flags.forEachFlag([&](TestFlag flag) -> void { sum += static_cast<size_t>(flag); });
+
+    return sum;
+}
+
+///
+/// Verify `findNthSetBitIndex()`, `extract()` and `deposit()` of the given storage type against a bit-by-bit implementation
+///
+template <typename T>
+static void testBitPermutations()
+{
+    static constexpr size_t kNumBits = sizeof(T) * 8;
+
+    for (uint32_t trial = 0; trial < 10000; trial += 1)
+    {
+        T value = 0, mask = 0;
+
+        // Vary the density of both integers, and include all zeros and all ones
+        for (size_t word = 0; word < (kNumBits + 63) / 64; word += 1)
+        {
+            uint64_t random = static_cast<uint64_t>(rand()) << 32 | rand();
+
+            uint64_t other = static_cast<uint64_t>(rand()) << 32 | rand();
+
+            value |= static_cast<T>(trial % 7 == 0 ? ~0ULL : random & (trial % 3 == 0 ? other : ~0ULL)) << (word * 64);
+
+            mask |= static_cast<T>(trial % 11 == 0 ? 0 : random ^ other) << (word * 64);
+        }
+
+        BitOptions<T> options(value);
+
+        // Bit-by-bit reference implementations
+        T extracted = 0, deposited = 0;
+
+        size_t numSetBits = 0, numMaskBits = 0;
+
+        for (size_t index = 0; index < kNumBits; index += 1)
+        {
+            T bit = static_cast<T>(1) << index;
+
+            if ((value & bit) != 0)
+            {
+                passert(options.findNthSetBitIndex(numSetBits) == index, "NthSetBit%lu: Trial %u, k = %lu.", kNumBits, trial, numSetBits);
+
+                numSetBits += 1;
+            }
+
+            if ((mask & bit) != 0)
+            {
+                if ((value & bit) != 0)
+                {
+                    extracted |= static_cast<T>(1) << numMaskBits;
+                }
+
+                if ((value & (static_cast<T>(1) << numMaskBits)) != 0)
+                {
+                    deposited |= bit;
+                }
+
+                numMaskBits += 1;
+            }
+        }
+
+        passert(options.findNthSetBitIndex(numSetBits) == kNumBits && options.findNthSetBitIndex(kNumBits) == kNumBits, "NthSetBit%lu: Trial %u, out of range.", kNumBits, trial);
+
+        passert(options.extract(mask).flatten() == extracted, "Extract%lu: Trial %u.", kNumBits, trial);
+
+        passert(options.deposit(mask).flatten() == deposited, "Deposit%lu: Trial %u.", kNumBits, trial);
+
+        // Depositing the extracted bits restores the selected bits
+        passert(options.extract(mask).deposit(mask).flatten() == (value & mask), "Extract%lu/Deposit%lu: Trial %u.", kNumBits, kNumBits, trial);
+
+        // The portable implementation must agree with the selected backend
+        if constexpr (sizeof(T) <= sizeof(uint64_t))
+        {
+            passert(PortableBitExtractor<kNumBits>()(value, mask) == extracted && PortableBitDepositor<kNumBits>()(value, mask) == deposited, "Portable%lu: Trial %u.", kNumBits, trial);
+
+            passert(PortableNthSetBitFinder()(value, trial % 64) == NthSetBitFinder<uint64_t>()(value, trial % 64), "Portable NthSetBit%lu: Trial %u.", kNumBits, trial);
+        }
+    }
+}
+
 void BitOptionsTest::run()
 {
     // Insertion
@@ -130,4 +233,126 @@ void BitOptionsTest::run()
 
     pinfo("BitOptions Set/Get: Test Passed.");
 
+    // Count
+    passert(options.count() == 4, "Count");
+
+    passert(BitOptions<uint8_t>(0xFF).count() == 8, "Count");
+
+    passert(BitOptions<uint64_t>(~0ULL).count() == 64, "Count");
+
+    passert(BitOptions<uint64_t>(0x8000000000000001ULL).count() == 2, "Count");
+
+    passert(BitOptions<uint16_t>().count() == 0, "Count");
+
+    pinfo("BitOptions Count: Test Passed.");
+
+    // Iterate Set Bits
+    static_assert(std::forward_iterator<BitOptions<uint32_t>::SetBitIterator>);
+
+    size_t expectedIndices[] = { 1, 2, 3, 8 };
+
+    size_t position = 0;
+
+    for (uint32_t index : options)
+    {
+        passert(position < 4 && index == expectedIndices[position], "Iterate Set Bits");
+
+        position += 1;
+    }
+
+    passert(position == 4, "Iterate Set Bits");
+
+    position = 0;
+
+    options.forEachSetBit([&](uint32_t index) -> void
+    {
+        passert(position < 4 && index == expectedIndices[position], "For Each Set Bit");
+
+        position += 1;
+    });
+
+    passert(position == 4, "For Each Set Bit");
+
+    passert(BitOptions<uint8_t>().begin() == BitOptions<uint8_t>().end(), "Iterate Set Bits");
+
+    passert(*BitOptions<uint64_t>(1ULL << 63).begin() == 63, "Iterate Set Bits");
+
+    pinfo("BitOptions Iterate Set Bits: Test Passed.");
+
+    // Test Bit Permutations
+    static_assert(BitOptions<uint64_t>(0b10110010).findNthSetBitIndex(2) == 5 && BitOptions<uint32_t>(0b1).findNthSetBitIndex(1) == 32, "NthSetBit constexpr");
+
+    static_assert(BitOptions<uint8_t>(0b10110010).extract(0b11110000).flatten() == 0b1011, "Extract constexpr");
+
+    static_assert(BitOptions<uint16_t>(0b1011).deposit(0b11110000).flatten() == 0b10110000, "Deposit constexpr");
+
+    testBitPermutations<uint8_t>();
+
+    testBitPermutations<uint16_t>();
+
+    testBitPermutations<uint32_t>();
+
+    testBitPermutations<uint64_t>();
+
+    testBitPermutations<UInt128>();
+
+    testBitPermutations<UInt256>();
+
+    pinfo("BitOptions Bit Permutations: Test Passed.");
+
+    // Compile Time Evaluation
+    static constexpr BitOptions<uint32_t> kConstants = BitOptions<uint32_t>().insert(BitOptions<uint32_t>::createOption<3>()).insert(BitOptions<uint32_t>::createOptionWithIndex(31));
+
+    static_assert(kConstants.flatten() == 0x80000008 && kConstants.count() == 2, "Constexpr Insert");
+
+    static_assert(kConstants.containsAll(0x8, 0x80000000) && !kConstants.containsOneOf(0x1, 0x2), "Constexpr Contains");
+
+    static_assert(kConstants.findLeastSignificantBitIndex() == 3 && kConstants.findMostSignificantBitIndex() == 31, "Constexpr LSB/MSB");
+
+    static_assert((kConstants & BitOptions<uint32_t>(0xF)) == BitOptions<uint32_t>(0x8), "Constexpr AND");
+
+    static_assert(*++kConstants.begin() == 31, "Constexpr Iterate Set Bits");
+
+    pinfo("BitOptions Constexpr: Test Passed.");
+
+    // Bit Flags
+    static_assert(std::same_as<BitFlags<TestFlag>::StorageUnit, uint16_t> && BitFlags<TestFlag>::NumFlags == 9, "Storage Type");
+
+    static constexpr BitFlags kReadWrite(TestFlag::Read, TestFlag::Write);
+
+    static_assert(kReadWrite.getRawValue() == 0b11 && kReadWrite.count() == 2, "Constexpr BitFlags");
+
+    static_assert(kReadWrite.containsAll(TestFlag::Write, TestFlag::Read) && !kReadWrite.containsAll(TestFlag::Read, TestFlag::Execute), "Constexpr BitFlags Contains All");
+
+    static_assert(kReadWrite.containsOneOf(TestFlag::Execute, TestFlag::Write) && !kReadWrite.containsOneOf(TestFlag::Execute, TestFlag::Huge), "Constexpr BitFlags Contains One Of");
+
+    static_assert(BitFlags<TestFlag>::all().getRawValue() == 0x1FF && (~kReadWrite).getRawValue() == 0x1FC, "Constexpr BitFlags Complement");
+
+    static_assert(sumOfFlags(kReadWrite | TestFlag::Huge) == 9, "Constexpr BitFlags For Each Flag");
+
+    BitFlags<TestFlag> flags = TestFlag::Execute;
+
+    passert(flags.contains(TestFlag::Execute) && !flags.contains(TestFlag::Read), "BitFlags Contains");
+
+    flags.mutativeInsert(TestFlag::Huge, TestFlag::Read);
+
+    passert(flags.getRawValue() == 0x105 && flags.containsAll(TestFlag::Huge, TestFlag::Read, TestFlag::Execute), "BitFlags Insert");
+
+    flags.mutativeRemove(TestFlag::Read, TestFlag::Write);
+
+    passert(flags == BitFlags(TestFlag::Execute, TestFlag::Huge), "BitFlags Remove");
+
+    passert(flags.insert(TestFlag::Dirty).remove(TestFlag::Huge) == BitFlags(TestFlag::Dirty, TestFlag::Execute), "BitFlags Insert and Remove");
+
+    flags &= kReadWrite;
+
+    passert(flags.isEmpty() && flags == BitFlags<TestFlag>(), "BitFlags AND");
+
+    flags |= kReadWrite;
+
+    passert((flags ^ BitFlags<TestFlag>(TestFlag::Read)) == TestFlag::Write, "BitFlags OR and XOR");
+
+    passert(BitFlags<TestFlag>::createWithRawValue(0xFFFF) == BitFlags<TestFlag>::all(), "BitFlags Raw Value");
+
+    pinfo("BitFlags: Test Passed.");
 }
@@ -0,0 +1,173 @@
+//
+//  CPUDispatchTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "CPUDispatchTest.hpp"
+#include "CPUDispatch.hpp"
+#include "Debug.hpp"
+#include <cstdlib>
+#include <cstring>
+
+/// The number of bytes in the arrays passed to kernels
+static constexpr size_t kNumBytes = 8192;
+
+///
+/// Verify the kernels in the given table against the bit-by-bit and byte-by-byte reference implementations
+///
+/// @param table The table of kernels selected for a set of processor features
+///
+static void testKernels(const CPUDispatchTable& table)
+{
+    static uint64_t values[kNumBytes / sizeof(uint64_t)];
+
+    static uint32_t indices[kNumBytes / sizeof(uint64_t) + 1];
+
+    static uint8_t source[kNumBytes], destination[kNumBytes];
+
+    // Mix zeros, all ones and sparse integers into random ones
+    for (size_t index = 0; index < kNumBytes / sizeof(uint64_t); index += 1)
+    {
+        uint64_t random = static_cast<uint64_t>(rand()) << 32 | rand();
+
+        values[index] = index % 5 == 0 ? 0 : index % 7 == 0 ? ~0ULL : index % 3 == 0 ? random & (random >> 17) : random;
+    }
+
+    for (auto& byte : source)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+
+    // Lengths around each register width, and a few larger ones
+    for (size_t count = 0; count <= 40; count += 1)
+    {
+        for (size_t length : { count, count * 7 + 13, count * 101 + 1000 })
+        {
+            size_t numValues = length % (kNumBytes / sizeof(uint64_t));
+
+            // LSB and MSB: The kernels must not write beyond the arrays
+            indices[numValues] = 0xDEADBEEF;
+
+            table.findLeastSignificantBitIndices.function(values, indices, numValues);
+
+            for (size_t index = 0; index < numValues; index += 1)
+            {
+                passert(indices[index] == LSBFinder<uint64_t>()(values[index]), "%s LSB: Count = %lu; Index = %lu.", table.findLeastSignificantBitIndices.variant, numValues, index);
+            }
+
+            table.findMostSignificantBitIndices.function(values, indices, numValues);
+
+            for (size_t index = 0; index < numValues; index += 1)
+            {
+                passert(indices[index] == MSBFinder<uint64_t>()(values[index]), "%s MSB: Count = %lu; Index = %lu.", table.findMostSignificantBitIndices.variant, numValues, index);
+            }
+
+            passert(indices[numValues] == 0xDEADBEEF, "LSB/MSB: Count = %lu; Overflow.", numValues);
+
+            // Population Count
+            size_t numSetBits = 0;
+
+            for (size_t index = 0; index < numValues; index += 1)
+            {
+                for (size_t bit = 0; bit < 64; bit += 1)
+                {
+                    numSetBits += (values[index] >> bit) & 1;
+                }
+            }
+
+            passert(table.countSetBits.function(values, numValues) == numSetBits, "%s POP: Count = %lu.", table.countSetBits.variant, numValues);
+
+            // Copy and fill at misaligned addresses: Bytes outside the range must remain intact
+            size_t offset = count % 5;
+
+            size_t numBytes = length % (kNumBytes - 2 * offset);
+
+            memset(destination, 0xA5, kNumBytes);
+
+            passert(table.copyMemory.function(destination + offset, source + count % 3, numBytes) == destination + offset, "%s Copy: Return Value.", table.copyMemory.variant);
+
+            passert(memcmp(destination + offset, source + count % 3, numBytes) == 0, "%s Copy: Length = %lu.", table.copyMemory.variant, numBytes);
+
+            passert(destination[offset + numBytes] == 0xA5 && (offset == 0 || destination[offset - 1] == 0xA5), "%s Copy: Length = %lu; Overflow.", table.copyMemory.variant, numBytes);
+
+            passert(table.fillMemory.function(destination + offset, 0x1C3, numBytes) == destination + offset, "%s Fill: Return Value.", table.fillMemory.variant);
+
+            for (size_t index = 0; index < numBytes; index += 1)
+            {
+                passert(destination[offset + index] == 0xC3, "%s Fill: Length = %lu; Index = %lu.", table.fillMemory.variant, numBytes, index);
+            }
+
+            passert(destination[offset + numBytes] == 0xA5 && (offset == 0 || destination[offset - 1] == 0xA5), "%s Fill: Length = %lu; Overflow.", table.fillMemory.variant, numBytes);
+        }
+    }
+
+    pinfo("Kernels: LSB = %s; MSB = %s; POP = %s; Copy = %s; Fill = %s: Test Passed.",
+          table.findLeastSignificantBitIndices.variant,
+          table.findMostSignificantBitIndices.variant,
+          table.countSetBits.variant,
+          table.copyMemory.variant,
+          table.fillMemory.variant);
+}
+
+void CPUDispatchTest::run()
+{
+    pinfof("==== TEST CPU DISPATCH STARTED ====\n");
+
+    CPUFeatures detected = CPUFeatures::detect();
+
+    pinfo("Features: POPCNT = %d; LZCNT = %d; AVX2 = %d; AVX512F = %d; AVX512CD = %d; AVX512VPOPCNTDQ = %d; ERMS = %d.",
+          detected.popcnt, detected.lzcnt, detected.avx2, detected.avx512f, detected.avx512cd, detected.avx512vpopcntdq, detected.erms);
+
+    // The table is resolved at startup
+    CPUDispatchTable expected = CPUDispatchTable::createWithFeatures(detected);
+
+    const CPUDispatchTable& resolved = CPUDispatcher::getTable();
+
+    passert(resolved.findLeastSignificantBitIndices.function == expected.findLeastSignificantBitIndices.function &&
+            resolved.findMostSignificantBitIndices.function == expected.findMostSignificantBitIndices.function &&
+            resolved.countSetBits.function == expected.countSetBits.function &&
+            resolved.copyMemory.function == expected.copyMemory.function &&
+            resolved.fillMemory.function == expected.fillMemory.function, "Resolved at startup.");
+
+    // A processor without any of the features gets the portable kernels
+    CPUDispatchTable portable = CPUDispatchTable::createWithFeatures(CPUFeatures());
+
+    passert(strcmp(portable.countSetBits.variant, "Portable") == 0 && portable.copyMemory.function == &PortableDispatchKernels::copyMemory, "Portable Table.");
+
+    // Test each tier of kernels that the current processor supports
+    CPUFeatures scalar = {};
+
+    scalar.popcnt = detected.popcnt;
+
+    scalar.lzcnt = detected.lzcnt;
+
+    scalar.erms = detected.erms;
+
+    // Leave out ERMS, so that the AVX2 kernels are used for all lengths
+    CPUFeatures avx2 = scalar;
+
+    avx2.avx2 = detected.avx2;
+
+    avx2.erms = false;
+
+    for (const CPUFeatures& features : { CPUFeatures(), scalar, avx2, detected })
+    {
+        testKernels(CPUDispatchTable::createWithFeatures(features));
+    }
+
+    // The dispatcher forwards calls to the resolved table
+    uint64_t words[] = { 0b1011, 0, 1ULL << 63 };
+
+    uint32_t msb[3];
+
+    CPUDispatcher::findMostSignificantBitIndices(words, msb, 3);
+
+    passert(CPUDispatcher::countSetBits(words, 3) == 4 && msb[0] == 3 && msb[1] == 0 && msb[2] == 63, "Dispatcher.");
+
+    pinfo("CPU Dispatch: Test Passed.");
+
+    pinfof("==== TEST CPU DISPATCH FINISHED ====\n");
+}
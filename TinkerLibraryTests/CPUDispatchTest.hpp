@@ -0,0 +1,20 @@
+//
+//  CPUDispatchTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef CPUDispatchTest_hpp
+#define CPUDispatchTest_hpp
+
+#include "TestSuite.hpp"
+
+class CPUDispatchTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* CPUDispatchTest_hpp */
@@ -0,0 +1,300 @@
+//
+//  CompressedBitVectorTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "CompressedBitVectorTest.hpp"
+#include "CompressedBitVector.hpp"
+#include <random>
+#include <set>
+
+/// An allocator that fails once a given number of bytes are in use
+struct BoundedAllocator
+{
+    size_t numBytesAvailable;
+
+    void* allocate(size_t size)
+    {
+        if (size > this->numBytesAvailable)
+        {
+            return nullptr;
+        }
+
+        this->numBytesAvailable -= size;
+
+        return ::operator new(size);
+    }
+
+    void deallocate(void* pointer, size_t size)
+    {
+        this->numBytesAvailable += size;
+
+        ::operator delete(pointer);
+    }
+};
+
+///
+/// Check whether the given compressed vector contains exactly the given set of bits
+///
+template <typename Allocator>
+static bool isEqual(const CompressedBitVector<Allocator>& vector, const std::set<uint32_t>& reference)
+{
+    if (vector.count() != reference.size())
+    {
+        return false;
+    }
+
+    // Visit set bits in ascending order
+    int64_t index = vector.findLeastSignificantBitIndex();
+
+    for (uint32_t expected : reference)
+    {
+        if (index != expected || !vector.containsBit(expected))
+        {
+            return false;
+        }
+
+        index = expected == UINT32_MAX ? -1 : vector.findNextSetBit(expected + 1);
+    }
+
+    return index == -1 && vector.findMostSignificantBitIndex() == (reference.empty() ? -1 : static_cast<int64_t>(*reference.rbegin()));
+}
+
+void CompressedBitVectorTest::run()
+{
+    pinfof("==== TEST COMPRESSED BIT VECTOR STARTED ====\n");
+
+    HeapBitVectorAllocator allocator;
+
+    // Test Basic Operations
+    {
+        CompressedBitVector<> vector(&allocator);
+
+        passert(vector.count() == 0 && vector.findLeastSignificantBitIndex() == -1 && vector.findMostSignificantBitIndex() == -1, "Search an empty vector.");
+
+        passert(vector.findNextSetBit(0) == -1 && !vector.containsBit(0), "Examine an empty vector.");
+
+        passert(vector.setBit(7) && vector.setBit(UINT32_MAX) && vector.setBit(0x12345678), "Set bits in different chunks.");
+
+        passert(vector.setBit(7) && vector.count() == 3, "Setting a bit twice has no effect.");
+
+        passert(vector.getBit(7) == 1 && vector.getBit(8) == 0 && vector.containsBit(UINT32_MAX), "Get bits.");
+
+        passert(vector.findLeastSignificantBitIndex() == 7 && vector.findMostSignificantBitIndex() == UINT32_MAX, "Find LSB and MSB.");
+
+        passert(vector.findNextSetBit(8) == 0x12345678 && vector.findNextSetBit(0x12345679) == UINT32_MAX, "Find the next set bit across chunks.");
+
+        passert(vector.clearBit(0x12345678) && vector.clearBit(0x12345678) && vector.count() == 2, "Clear a bit twice.");
+
+        passert(vector.numChunks == 2, "Release an empty chunk.");
+
+        // Indices at or above 2^31 are never mistaken for "not found"
+        passert(vector.clearBit(7) && vector.findLeastSignificantBitIndex() == UINT32_MAX && vector.findNextSetBit(0x80000000) == UINT32_MAX, "Find the last bit as the only set bit.");
+
+        passert(vector.setBit(0x80000000) && vector.findLeastSignificantBitIndex() == 0x80000000 && vector.findNextSetBit(0x80000001) == UINT32_MAX, "Find bits in the upper half.");
+
+        vector.initWithZeros();
+
+        passert(vector.count() == 0 && vector.numChunks == 0, "Init with zeros.");
+    }
+
+    // Test Container Conversions
+    {
+        using Vector = CompressedBitVector<>;
+
+        Vector vector(&allocator);
+
+        std::set<uint32_t> reference;
+
+        for (uint32_t index = 0; index < 4096; index += 1)
+        {
+            vector.setBit(index * 16);
+
+            reference.insert(index * 16);
+        }
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Array && vector.chunks[0].size == 4096, "Array container holds 4096 bits.");
+
+        vector.setBit(1);
+
+        reference.insert(1);
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Bitmap, "Array converts to bitmap beyond 4096 bits.");
+
+        passert(isEqual(vector, reference), "Bitmap matches the reference.");
+
+        // Clearing a bit right below the threshold must not convert the container back
+        vector.clearBit(1);
+
+        reference.erase(1);
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Bitmap, "Bitmap remains until it is half as dense.");
+
+        for (uint32_t index = 0; index < 2048; index += 1)
+        {
+            vector.clearBit(index * 32);
+
+            reference.erase(index * 32);
+        }
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Array && vector.chunks[0].size == 2048, "Bitmap converts to array at 2048 bits.");
+
+        passert(isEqual(vector, reference), "Array matches the reference.");
+
+        // Long runs of set bits compress into a few runs
+        vector.initWithZeros();
+
+        reference.clear();
+
+        for (uint32_t index = 100; index <= 60000; index += 1)
+        {
+            vector.setBit(index);
+
+            reference.insert(index);
+        }
+
+        vector.setBit(70000);
+
+        reference.insert(70000);
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Bitmap && vector.chunks[1].type == Vector::ContainerType::Array, "Dense chunk uses a bitmap.");
+
+        size_t usage = vector.getMemoryUsage();
+
+        vector.optimize();
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Runs && vector.chunks[0].size == 1, "Optimize converts a dense chunk to a single run.");
+
+        passert(vector.chunks[1].type == Vector::ContainerType::Array, "Optimize keeps the array of a single bit.");
+
+        passert(vector.getMemoryUsage() < usage - 8000, "Runs save memory.");
+
+        passert(isEqual(vector, reference), "Runs match the reference.");
+
+        // Split, shrink, extend and merge runs
+        passert(vector.clearBit(30000) && vector.chunks[0].size == 2, "Clear a bit in the middle of a run.");
+
+        passert(vector.clearBit(100) && vector.clearBit(60000) && vector.chunks[0].size == 2, "Clear the ends of runs.");
+
+        passert(vector.setBit(99) && vector.setBit(60001) && vector.chunks[0].size == 4, "Set standalone bits next to the gaps.");
+
+        passert(vector.setBit(100) && vector.setBit(60000) && vector.chunks[0].size == 2, "Set bits that merge two runs.");
+
+        passert(vector.setBit(30000) && vector.chunks[0].size == 1 && vector.chunks[0].runs()[0].first == 99, "Set a bit that fills the last gap.");
+
+        passert(vector.setBit(50) && vector.chunks[0].size == 2, "Set a standalone bit.");
+
+        reference.insert(50);
+
+        reference.insert(99);
+
+        reference.insert(60001);
+
+        passert(isEqual(vector, reference), "Modified runs match the reference.");
+
+        // Too many runs convert back to a bitmap
+        for (uint32_t index = 0; index < 100; index += 2)
+        {
+            vector.clearBit(1000 + index * 2);
+
+            reference.erase(1000 + index * 2);
+        }
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Runs, "Runs remain while they are small.");
+
+        for (uint32_t index = 1000; index < 60000; index += 2)
+        {
+            vector.clearBit(index);
+
+            reference.erase(index);
+        }
+
+        passert(vector.chunks[0].type == Vector::ContainerType::Bitmap, "Runs convert to a bitmap beyond 2048 runs.");
+
+        passert(isEqual(vector, reference), "Bitmap converted from runs matches the reference.");
+    }
+
+    // Test Randomized Operations
+    {
+        CompressedBitVector<> vector(&allocator);
+
+        std::set<uint32_t> reference;
+
+        std::mt19937 generator(2026);
+
+        // Indices are concentrated in a few chunks, so that all kinds of containers show up
+        std::uniform_int_distribution<uint32_t> chunks(0, 3), values(0, 12000);
+
+        for (size_t round = 0; round < 200000; round += 1)
+        {
+            uint32_t index = (chunks(generator) << 16) | values(generator);
+
+            if (round % 3 == 0)
+            {
+                vector.clearBit(index);
+
+                reference.erase(index);
+            }
+            else
+            {
+                vector.setBit(index);
+
+                reference.insert(index);
+            }
+
+            if (round % 50000 == 0)
+            {
+                vector.optimize();
+            }
+        }
+
+        passert(isEqual(vector, reference), "Randomized operations match the reference.");
+    }
+
+    // Test Sparse Memory Usage
+    {
+        CompressedBitVector<> vector(&allocator);
+
+        std::mt19937 generator(17);
+
+        std::uniform_int_distribution<uint32_t> distribution;
+
+        for (size_t count = 0; count < 4096; count += 1)
+        {
+            vector.setBit(distribution(generator));
+        }
+
+        // A static bit vector of 2^32 bits takes 512 MiB
+        passert(vector.getMemoryUsage() * 100 < (size_t(1) << 29), "Sparse vector uses at least 100x less memory than a static bit vector.");
+
+        pinfof("Sparse vector of %lu bits uses %lu bytes.\n", vector.count(), vector.getMemoryUsage());
+    }
+
+    // Test Out of Memory
+    {
+        BoundedAllocator bounded = { 256 };
+
+        CompressedBitVector<BoundedAllocator> vector(&bounded);
+
+        passert(vector.setBit(1), "Set a bit with enough memory.");
+
+        size_t count = 1;
+
+        while (vector.setBit(static_cast<uint32_t>(count) << 16))
+        {
+            count += 1;
+        }
+
+        passert(vector.count() == count && !vector.containsBit(static_cast<uint32_t>(count) << 16), "Failed allocation leaves the bit clear.");
+
+        passert(vector.numChunks == count, "Failed allocation does not leave an empty chunk.");
+
+        // A new array of a single bit needs memory, but clearing it does not
+        passert(vector.clearBit(1) && !vector.containsBit(1), "Clear a bit without memory.");
+    }
+
+    pinfof("==== TEST COMPRESSED BIT VECTOR FINISHED ====\n");
+}
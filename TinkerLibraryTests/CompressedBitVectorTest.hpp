@@ -0,0 +1,20 @@
+//
+//  CompressedBitVectorTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef CompressedBitVectorTest_hpp
+#define CompressedBitVectorTest_hpp
+
+#include "TestSuite.hpp"
+
+class CompressedBitVectorTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* CompressedBitVectorTest_hpp */
@@ -0,0 +1,212 @@
+//
+//  DynamicBitVectorTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "DynamicBitVectorTest.hpp"
+#include "DynamicBitVector.hpp"
+#include "StaticBitVector.hpp"
+#include <algorithm>
+#include <ranges>
+
+/// An allocator that records the number of allocations and the number of bytes in use
+struct CountingAllocator
+{
+    size_t numAllocations = 0;
+
+    size_t numBytesInUse = 0;
+
+    void* allocate(size_t size)
+    {
+        this->numAllocations += 1;
+
+        this->numBytesInUse += size;
+
+        return new uint64_t[(size + sizeof(uint64_t) - 1) / sizeof(uint64_t)];
+    }
+
+    void deallocate(void* pointer, size_t size)
+    {
+        this->numBytesInUse -= size;
+
+        delete[] reinterpret_cast<uint64_t*>(pointer);
+    }
+};
+
+void DynamicBitVectorTest::run()
+{
+    pinfof("==== TEST DYNAMIC BIT VECTOR STARTED ====\n");
+
+    static_assert(std::ranges::forward_range<DynamicBitVector<>>);
+
+    // Test Caller-Supplied Buffer
+    uint8_t buffer[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+
+    DynamicBitVector<uint8_t> vector(buffer, sizeof(buffer));
+
+    passert(vector.getNumBits() == 0 && vector.getCapacity() == 32, "Create with a buffer.");
+
+    passert(vector.findFirstZeroBitIndex() == -1 && vector.findLeastSignificantBitIndex() == -1, "Search an empty vector.");
+
+    passert(vector.resize(12), "Resize within the buffer.");
+
+    passert(buffer[0] == 0 && buffer[1] == 0, "New bits are zero.");
+
+    passert(buffer[2] == 0xFF, "Bytes beyond the size are untouched.");
+
+    vector.initWithOnes();
+
+    passert(buffer[0] == 0xFF && buffer[1] == 0x0F, "Init with ones.");
+
+    passert(vector.findFirstZeroBitIndex() == -1 && vector.findMostSignificantBitIndex() == 11, "Find the first zero bit and MSB after init with ones.");
+
+    passert(!vector.resize(33), "Cannot grow beyond the buffer without an allocator.");
+
+    passert(vector.getNumBits() == 12 && vector.count() == 12, "The vector is unchanged after a failed resize.");
+
+    // Shrink and then grow again: The bits in between must be zero
+    passert(vector.resize(5), "Shrink.");
+
+    passert(buffer[0] == 0x1F && vector.count() == 5, "Shrink clears nonexistent bits.");
+
+    passert(vector.resize(20), "Grow after shrink.");
+
+    passert(buffer[0] == 0x1F && buffer[1] == 0 && buffer[2] == 0, "Grow after shrink clears stale bits.");
+
+    passert(vector.findContiguousZeroRun(15) == 5 && vector.findContiguousZeroRun(16) == -1, "Find a run of zero bits after grow.");
+
+    pinfo("Caller-Supplied Buffer: Test Passed.");
+
+    // Test Growth by Doubling
+    CountingAllocator allocator;
+
+    {
+        DynamicBitVector<uint64_t, CountingAllocator> growing(&allocator);
+
+        passert(growing.resize(100), "Resize to 100 bits.");
+
+        passert(allocator.numAllocations == 1 && growing.getCapacity() == 128, "Allocate 2 blocks.");
+
+        growing.setBit(0);
+
+        growing.setBit(99);
+
+        growing.setBits(ClosedRange<size_t>(60, 70));
+
+        passert(growing.resize(129), "Resize to 129 bits.");
+
+        passert(allocator.numAllocations == 2 && growing.getCapacity() == 256, "Double the capacity to 4 blocks.");
+
+        passert(allocator.numBytesInUse == 32, "Release the old storage.");
+
+        passert(growing.count() == 13 && growing.containsBit(0) && growing.containsBit(99) && growing.allSet(ClosedRange<size_t>(60, 70)), "Keep existing bits after grow.");
+
+        passert(growing.noneSet(ClosedRange<size_t>(100, 128)), "New bits are zero after grow.");
+
+        passert(growing.resize(256), "Resize to the capacity.");
+
+        passert(allocator.numAllocations == 2, "No allocation within the capacity.");
+
+        passert(growing.resize(300), "Resize to 300 bits.");
+
+        passert(allocator.numAllocations == 3 && growing.getCapacity() == 512, "Double the capacity to 8 blocks.");
+
+        passert(growing.reserve(5000), "Reserve 5000 bits.");
+
+        passert(allocator.numAllocations == 4 && growing.getCapacity() == 5056, "Reserve more than double the capacity.");
+
+        passert(growing.getNumBits() == 300 && growing.findMostSignificantBitIndex() == 99, "Reserve does not change the size.");
+    }
+
+    passert(allocator.numBytesInUse == 0, "Release the storage on destruction.");
+
+    // A buffer that overflows to the allocator
+    uint32_t smallBuffer[1] = { 0 };
+
+    {
+        DynamicBitVector<uint32_t, CountingAllocator> overflowing(smallBuffer, sizeof(smallBuffer), &allocator);
+
+        passert(overflowing.resize(32) && allocator.numAllocations == 4, "Resize within the buffer.");
+
+        overflowing.setBit(31);
+
+        passert(overflowing.resize(33) && allocator.numAllocations == 5 && overflowing.getCapacity() == 64, "Grow out of the buffer.");
+
+        passert(overflowing.containsBit(31) && overflowing.count() == 1, "Keep existing bits after leaving the buffer.");
+    }
+
+    passert(allocator.numBytesInUse == 0, "Never release the buffer supplied by the caller.");
+
+    pinfo("Growth by Doubling: Test Passed.");
+
+    // Test Parity with Static Bit Vectors
+    StaticBitVector<1000, uint16_t> expected;
+
+    DynamicBitVector<uint16_t, CountingAllocator> actual(&allocator);
+
+    passert(actual.resize(1000), "Resize to 1000 bits.");
+
+    expected.initWithZeros();
+
+    actual.initWithZeros();
+
+    for (size_t index = 7; index < 1000; index += index / 3 + 1)
+    {
+        expected.setBit(index);
+
+        actual.setBit(index);
+    }
+
+    expected.setRange(400, 90);
+
+    actual.setRange(400, 90);
+
+    for (size_t index = 0; index < 1000; index += 37)
+    {
+        passert(actual.findNextSetBit(index) == expected.findNextSetBit(index), "Find the next set bit from %lu.", index);
+
+        passert(actual.findNextZeroBit(index) == expected.findNextZeroBit(index), "Find the next zero bit from %lu.", index);
+
+        passert(actual.rank(index) == expected.rank(index), "Rank of bit %lu.", index);
+
+        ClosedRange<size_t> range(index / 2, index);
+
+        passert(actual.findLeastSignificantBitIndexWithRange(range) == expected.findLeastSignificantBitIndexWithRange(range), "Find LSB in [%lu, %lu].", index / 2, index);
+
+        passert(actual.findMostSignificantBitIndexWithRange(range) == expected.findMostSignificantBitIndexWithRange(range), "Find MSB in [%lu, %lu].", index / 2, index);
+    }
+
+    passert(actual.count() == expected.count() && actual.select(20) == expected.select(20), "Count and select.");
+
+    passert(actual.findContiguousZeroRun(100, 8) == expected.findContiguousZeroRun(100, 8), "Find a run of zero bits.");
+
+    passert(std::ranges::equal(actual, expected), "Iterate set bits.");
+
+    // Test Bitwise Algebra
+    DynamicBitVector<uint16_t, CountingAllocator> other(&allocator);
+
+    passert(other.resize(999), "Resize to 999 bits.");
+
+    other.initWithOnes();
+
+    actual &= other;
+
+    passert(actual.count() == expected.count(), "Mismatched sizes have no effect.");
+
+    passert(!actual.isSubsetOf(other) && !actual.intersects(other), "Mismatched sizes are neither subsets nor intersecting.");
+
+    passert(other.resize(1000), "Resize to 1000 bits.");
+
+    passert(actual.isSubsetOf(other) && !other.isSubsetOf(actual), "Subset after resize.");
+
+    other.andNot(actual);
+
+    passert(!other.intersects(actual) && other.count() == 999 - actual.count(), "ANDNOT after resize.");
+
+    pinfo("Parity with Static Bit Vectors: Test Passed.");
+
+    pinfof("==== TEST DYNAMIC BIT VECTOR FINISHED ====\n");
+}
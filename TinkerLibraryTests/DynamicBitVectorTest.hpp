@@ -0,0 +1,20 @@
+//
+//  DynamicBitVectorTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef DynamicBitVectorTest_hpp
+#define DynamicBitVectorTest_hpp
+
+#include "TestSuite.hpp"
+
+class DynamicBitVectorTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* DynamicBitVectorTest_hpp */
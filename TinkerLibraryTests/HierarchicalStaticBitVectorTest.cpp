@@ -0,0 +1,228 @@
+//
+//  HierarchicalStaticBitVectorTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "HierarchicalStaticBitVectorTest.hpp"
+#include "HierarchicalStaticBitVector.hpp"
+#include "Debug.hpp"
+
+template <size_t NumBits, typename StorageUnit>
+void HierarchicalStaticBitVectorTest::compare(size_t rounds, uint32_t seed)
+{
+    StaticBitVector<NumBits, StorageUnit> expected;
+
+    HierarchicalStaticBitVector<NumBits, StorageUnit> actual;
+
+    expected.initWithZeros();
+
+    actual.initWithZeros();
+
+    passert(actual.findLeastSignificantBitIndex() == -1, "Find LSB in an empty vector.");
+
+    passert(actual.findMostSignificantBitIndex() == -1, "Find MSB in an empty vector.");
+
+    for (size_t round = 0; round < rounds; round += 1)
+    {
+        // Linear congruential generator to produce a reproducible sequence
+        seed = seed * 1103515245 + 12345;
+
+        size_t index = (seed >> 8) % NumBits;
+
+        // Set bits more often in early rounds and clear bits more often in late rounds
+        if ((seed >> 4) % rounds >= round)
+        {
+            expected.setBit(index);
+
+            actual.setBit(index);
+        }
+        else
+        {
+            expected.clearBit(index);
+
+            actual.clearBit(index);
+        }
+
+        // Update a run of bits once in a while
+        if (round % 16 == 0)
+        {
+            size_t count = (seed >> 16) % (NumBits - index) + 1;
+
+            if ((seed >> 4) % rounds >= round)
+            {
+                expected.setRange(index, count);
+
+                actual.setRange(index, count);
+            }
+            else
+            {
+                expected.clearRange(index, count);
+
+                actual.clearRange(index, count);
+            }
+        }
+
+        passert(actual.getBit(index) == expected.getBit(index), "Round %lu: Get bit at index %lu.", round, index);
+
+        passert(actual.findLeastSignificantBitIndex() == expected.findLeastSignificantBitIndex(), "Round %lu: Find LSB.", round);
+
+        passert(actual.findMostSignificantBitIndex() == expected.findMostSignificantBitIndex(), "Round %lu: Find MSB.", round);
+
+        size_t lowerBound = (seed >> 12) % NumBits;
+
+        size_t upperBound = lowerBound + (seed >> 3) % (NumBits - lowerBound);
+
+        ClosedRange<size_t> range(lowerBound, upperBound);
+
+        passert(actual.findLeastSignificantBitIndexWithRange(range) == expected.findLeastSignificantBitIndexWithRange(range),
+                "Round %lu: Find LSB with range [%lu, %lu].", round, lowerBound, upperBound);
+
+        passert(actual.findMostSignificantBitIndexWithRange(range) == expected.findMostSignificantBitIndexWithRange(range),
+                "Round %lu: Find MSB with range [%lu, %lu].", round, lowerBound, upperBound);
+
+        passert(actual.findFirstZeroBitIndexWithRange(range) == expected.findFirstZeroBitIndexWithRange(range),
+                "Round %lu: Find the first zero bit with range [%lu, %lu].", round, lowerBound, upperBound);
+
+        passert(actual.findNextSetBit(lowerBound) == expected.findNextSetBit(lowerBound), "Round %lu: Find the next set bit from %lu.", round, lowerBound);
+
+        passert(actual.findNextZeroBit(lowerBound) == expected.findNextZeroBit(lowerBound), "Round %lu: Find the next zero bit from %lu.", round, lowerBound);
+
+        passert(actual.allSet(range) == expected.allSet(range), "Round %lu: All bits in [%lu, %lu] are set.", round, lowerBound, upperBound);
+
+        passert(actual.noneSet(range) == expected.noneSet(range), "Round %lu: No bit in [%lu, %lu] is set.", round, lowerBound, upperBound);
+
+        passert(actual.rank(lowerBound) == expected.rank(lowerBound), "Round %lu: Rank of bit %lu.", round, lowerBound);
+
+        passert(actual.select(round) == expected.select(round), "Round %lu: Select the %lu-th bit.", round, round);
+
+        passert(actual.findContiguousZeroRun(round % 8 + 1, 4) == expected.findContiguousZeroRun(round % 8 + 1, 4), "Round %lu: Find a run of zero bits.", round);
+    }
+
+    // Iterate set bits left by the updates
+    auto iterator = expected.begin();
+
+    actual.forEachSetBit([&](size_t index) -> void
+    {
+        passert(iterator != expected.end() && *iterator == index, "For each set bit: Index %lu.", index);
+
+        ++iterator;
+    });
+
+    passert(iterator == expected.end(), "For each set bit.");
+
+    // Combine with another vector that has every third bit set
+    StaticBitVector<NumBits, StorageUnit> otherExpected;
+
+    HierarchicalStaticBitVector<NumBits, StorageUnit> other;
+
+    otherExpected.initWithZeros();
+
+    other.initWithZeros();
+
+    for (size_t index = 0; index < NumBits; index += 3)
+    {
+        otherExpected.setBit(index);
+
+        other.setBit(index);
+    }
+
+    passert(actual.intersects(other) == expected.intersects(otherExpected), "Intersect.");
+
+    passert(actual.isSubsetOf(other) == expected.isSubsetOf(otherExpected), "Subset.");
+
+    auto verify = [&](const char* operation) -> void
+    {
+        passert(actual.findLeastSignificantBitIndex() == expected.findLeastSignificantBitIndex(), "%s: Find LSB.", operation);
+
+        passert(actual.findMostSignificantBitIndex() == expected.findMostSignificantBitIndex(), "%s: Find MSB.", operation);
+
+        for (size_t index = 0; index < NumBits; index += NumBits / 64 + 1)
+        {
+            passert(actual.findNextSetBit(index) == expected.findNextSetBit(index), "%s: Find the next set bit from %lu.", operation, index);
+        }
+    };
+
+    actual ^= other;
+
+    expected ^= otherExpected;
+
+    verify("XOR");
+
+    actual |= other;
+
+    expected |= otherExpected;
+
+    verify("OR");
+
+    actual.andNot(other);
+
+    expected.andNot(otherExpected);
+
+    verify("ANDNOT");
+
+    passert(!actual.intersects(other), "Intersect after ANDNOT.");
+
+    actual |= other;
+
+    actual &= other;
+
+    passert(actual.isSubsetOf(other) && other.isSubsetOf(actual), "Subset after AND.");
+
+    passert(actual.findMostSignificantBitIndex() == otherExpected.findMostSignificantBitIndex(), "Find MSB after AND.");
+
+    // Out-of-bounds updates must not leak into the summary
+    actual.initWithZeros();
+
+    actual.setBit(NumBits);
+
+    passert(actual.findLeastSignificantBitIndex() == -1, "Set an invalid bit.");
+
+    // The vector becomes empty once all bits are cleared
+    actual.initWithOnes();
+
+    passert(actual.findLeastSignificantBitIndex() == 0, "Find LSB after init with ones.");
+
+    passert(actual.findMostSignificantBitIndex() == NumBits - 1, "Find MSB after init with ones.");
+
+    passert(actual.findFirstZeroBitIndex() == -1, "Find the first zero bit after init with ones.");
+
+    for (size_t index = 0; index < NumBits; index += 1)
+    {
+        actual.clearBit(index);
+    }
+
+    passert(actual.findLeastSignificantBitIndex() == -1, "Find LSB after clearing all bits.");
+
+    passert(actual.findMostSignificantBitIndex() == -1, "Find MSB after clearing all bits.");
+
+    pinfo("NumBits = %lu; StorageUnit Size = %lu: Test Passed.", NumBits, sizeof(StorageUnit));
+}
+
+void HierarchicalStaticBitVectorTest::run()
+{
+    pinfof("==== TEST HIERARCHICAL STATIC BIT VECTOR STARTED ====\n");
+
+    // Two levels: The summary fits in a single block
+    HierarchicalStaticBitVectorTest::compare<12, uint8_t>(256, 1);
+
+    HierarchicalStaticBitVectorTest::compare<64, uint8_t>(512, 2);
+
+    // Two levels: The summary spans multiple blocks
+    HierarchicalStaticBitVectorTest::compare<5000, uint64_t>(8192, 4);
+
+    HierarchicalStaticBitVectorTest::compare<262144, uint64_t>(8192, 5);
+
+    // Three levels: 1000 bits -> 125 bits -> 16 bits
+    HierarchicalStaticBitVectorTest::compare<1000, uint8_t>(4096, 3);
+
+    // Three levels: 2^20 bits -> 16384 bits -> 256 bits
+    HierarchicalStaticBitVectorTest::compare<1048576, uint64_t>(8192, 6);
+
+    // Four levels: 5000 bits -> 625 bits -> 79 bits -> 10 bits
+    HierarchicalStaticBitVectorTest::compare<5000, uint8_t>(8192, 7);
+
+    pinfof("==== TEST HIERARCHICAL STATIC BIT VECTOR FINISHED ====\n");
+}
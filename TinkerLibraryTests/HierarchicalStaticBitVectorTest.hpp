@@ -0,0 +1,27 @@
+//
+//  HierarchicalStaticBitVectorTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef HierarchicalStaticBitVectorTest_hpp
+#define HierarchicalStaticBitVectorTest_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include "TestSuite.hpp"
+
+class HierarchicalStaticBitVectorTest: public TestSuite
+{
+public:
+    void run() override;
+
+private:
+    /// Compare the hierarchical bit vector against the plain one under a sequence of random updates
+    template <size_t NumBits, typename StorageUnit>
+    static void compare(size_t rounds, uint32_t seed);
+};
+
+#endif /* HierarchicalStaticBitVectorTest_hpp */
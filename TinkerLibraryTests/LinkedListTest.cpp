@@ -9,6 +9,9 @@
 #include "LinkedListTest.hpp"
 #include "LinkedList.hpp"
 #include "Debug.hpp"
+#include <algorithm>
+#include <initializer_list>
+#include <ranges>
 
 struct Number: Listable<Number>
 {
@@ -50,6 +53,44 @@ struct Number: Listable<Number>
     }
 };
 
+static_assert(std::ranges::bidirectional_range<LinkedList<Number>>, "A linked list is a bidirectional range.");
+
+static_assert(std::ranges::bidirectional_range<const LinkedList<Number>>, "A constant linked list is a bidirectional range.");
+
+static_assert(std::bidirectional_iterator<LinkedList<Number>::iterator> && std::bidirectional_iterator<LinkedList<Number>::const_iterator>, "Iterators are bidirectional.");
+
+static_assert(std::convertible_to<LinkedList<Number>::iterator, LinkedList<Number>::const_iterator>, "A mutable iterator converts to a constant one.");
+
+///
+/// Verify the links and the count of the given list
+///
+/// @param list The list to be verified
+/// @param values The expected values of the elements in forward order
+/// @return `true` if the list has the expected elements, `false` otherwise.
+///
+static bool verify(const LinkedList<Number>& list, std::initializer_list<uint32_t> values)
+{
+    if (list.getCount() != values.size() || !std::ranges::equal(list, values, {}, &Number::value))
+    {
+        return false;
+    }
+
+    // The backward links agree with the forward ones
+    const Number* expected = list.peekTail();
+
+    for (auto iterator = list.rbegin(); iterator != list.rend(); ++iterator)
+    {
+        if (&*iterator != expected)
+        {
+            return false;
+        }
+
+        expected = expected->prev;
+    }
+
+    return expected == nullptr && (list.isEmpty() || (list.peekHead()->prev == nullptr && list.peekTail()->next == nullptr));
+}
+
 void LinkedListTest::run()
 {
     pinfof("==== TEST LINKED LIST STARTED ====\n");
@@ -418,5 +459,120 @@ void LinkedListTest::run()
 
     passert(element1->value == 2, "Should be able to find 2.");
 
+    // Iterate the list in forward order: 4 -> 3 -> 2 -> 1
+    uint32_t expected = 4;
+
+    for (Number& number : numbers)
+    {
+        passert(number.value == expected, "Range-based for loop visits %u.", expected);
+
+        expected -= 1;
+    }
+
+    passert(expected == 0, "Range-based for loop visits all elements.");
+
+    // Iterate the list in backward order: 1 -> 2 -> 3 -> 4
+    for (auto iterator = numbers.rbegin(); iterator != numbers.rend(); ++iterator)
+    {
+        expected += 1;
+
+        passert(iterator->value == expected, "Reverse iterator visits %u.", expected);
+    }
+
+    passert(expected == 4, "Reverse iterator visits all elements.");
+
+    // The past-the-end iterator moves back to the tail
+    passert(&*std::prev(numbers.end()) == &n1 && &*std::next(numbers.begin()) == &n3, "Iterators move in both directions.");
+
+    passert(std::ranges::distance(numbers) == 4, "Distance between begin and end is 4.");
+
+    // Compose with range algorithms and views without copying nodes
+    const LinkedList<Number>& constNumbers = numbers;
+
+    auto found = std::ranges::find_if(constNumbers, [](const Number& number) { return number.value == 3; });
+
+    passert(found != constNumbers.end() && &*found == &n3, "Should be able to find 3.");
+
+    passert(std::ranges::find(numbers, Number(5)) == numbers.end(), "Should not be able to find 5.");
+
+    uint32_t sum = 0;
+
+    for (const Number& number : numbers | std::views::reverse | std::views::filter([](const Number& number) { return number.value % 2 == 0; }))
+    {
+        sum = sum * 10 + number.value;
+    }
+
+    passert(sum == 24, "Reversed even elements are 2 and 4.");
+
+    // Modify the elements through the iterators
+    std::ranges::for_each(numbers, [](Number& number) { number.value *= 10; });
+
+    passert(n1.value == 10 && n2.value == 20 && n3.value == 30 && n4.value == 40, "Elements are modified in place.");
+
+    // An empty list has no elements to iterate
+    LinkedList<Number> empty;
+
+    passert(empty.begin() == empty.end() && empty.rbegin() == empty.rend() && std::ranges::empty(empty), "An empty list.");
+
+    // Bulk Operations: Migrate tasks between two run queues
+    Number tasks[] = { Number(1), Number(2), Number(3), Number(4), Number(5), Number(6) };
+
+    LinkedList<Number> source, target;
+
+    for (Number& task : tasks)
+    {
+        source.enqueue(&task);
+    }
+
+    // Split after the 4th task with a known length
+    target.spliceBack(source.splitAfter(&tasks[3], 2));
+
+    passert(verify(source, {1, 2, 3, 4}) && verify(target, {5, 6}), "Split after 4 and splice back.");
+
+    // Split after the tail
+    passert(verify(source.splitAfter(&tasks[3]), {}) && verify(source, {1, 2, 3, 4}), "Split after the tail.");
+
+    // Split after the 1st task with a counted walk
+    LinkedList<Number> rest = source.splitAfter(&tasks[0]);
+
+    passert(verify(source, {1}) && verify(rest, {2, 3, 4}), "Split after 1.");
+
+    // Splice to the front of a non-empty list
+    target.spliceFront(rest);
+
+    passert(verify(target, {2, 3, 4, 5, 6}) && verify(rest, {}), "Splice front.");
+
+    // Splice an empty list, and splice into an empty list
+    target.spliceBack(rest);
+
+    target.spliceFront(rest);
+
+    rest.spliceFront(source);
+
+    passert(verify(target, {2, 3, 4, 5, 6}) && verify(rest, {1}) && verify(source, {}), "Splice empty lists.");
+
+    source.spliceBack(rest);
+
+    passert(verify(source, {1}) && verify(rest, {}), "Splice back into an empty list.");
+
+    // Remove a range in the middle with a known length
+    LinkedList<Number> middle = target.removeRange(&tasks[2], &tasks[3], 2);
+
+    passert(verify(target, {2, 5, 6}) && verify(middle, {3, 4}), "Remove the middle range.");
+
+    // Remove a range at the head and a range at the tail with a counted walk
+    source.spliceBack(target.removeRange(&tasks[1], &tasks[1]));
+
+    passert(verify(target, {5, 6}) && verify(source, {1, 2}), "Remove the head range.");
+
+    source.spliceBack(middle);
+
+    source.spliceBack(target.removeRange(&tasks[4], &tasks[5]));
+
+    passert(verify(target, {}) && verify(source, {1, 2, 3, 4, 5, 6}), "Remove the entire list.");
+
+    // The list remains usable after bulk operations
+    passert(source.dequeue() == &tasks[0] && source.pop() == &tasks[5] && verify(source, {2, 3, 4, 5}), "Queue operations.");
+
     pinfof("==== TEST LINKED LIST FINISHED ====\n");
 }
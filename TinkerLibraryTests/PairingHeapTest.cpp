@@ -0,0 +1,171 @@
+//
+//  PairingHeapTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "PairingHeapTest.hpp"
+#include "PairingHeap.hpp"
+#include "LinkedList.hpp"
+#include "Debug.hpp"
+#include <algorithm>
+#include <cstdlib>
+
+/// A task that is scheduled by its priority, and can be in a list and a heap at the same time
+struct Task: Listable<Task>, Heapable<Task>
+{
+    uint32_t priority;
+
+    bool isQueued;
+
+    friend bool operator<(const Task& lhs, const Task& rhs)
+    {
+        return lhs.priority < rhs.priority;
+    }
+};
+
+/// The number of tasks
+static constexpr size_t kNumTasks = 2000;
+
+///
+/// Find the minimum priority of the queued tasks by examining each task
+///
+/// @param tasks The array of tasks
+/// @return The minimum priority, or `UINT32_MAX` if no task is queued.
+///
+static uint32_t findMinimumPriority(const Task* tasks)
+{
+    uint32_t minimum = UINT32_MAX;
+
+    for (size_t index = 0; index < kNumTasks; index += 1)
+    {
+        if (tasks[index].isQueued && tasks[index].priority < minimum)
+        {
+            minimum = tasks[index].priority;
+        }
+    }
+
+    return minimum;
+}
+
+void PairingHeapTest::run()
+{
+    pinfof("==== TEST PAIRING HEAP STARTED ====\n");
+
+    auto* tasks = new Task[kNumTasks];
+
+    PairingHeap<Task> heap;
+
+    passert(heap.isEmpty() && heap.peekMin() == nullptr && heap.popMin() == nullptr, "An empty heap.");
+
+    for (size_t index = 0; index < kNumTasks; index += 1)
+    {
+        tasks[index].isQueued = false;
+    }
+
+    // Push: Many tasks share the same priority
+    for (size_t index = 0; index < kNumTasks; index += 1)
+    {
+        tasks[index].priority = static_cast<uint32_t>(rand()) % 500 + 1000;
+
+        tasks[index].isQueued = true;
+
+        heap.push(&tasks[index]);
+
+        passert(heap.peekMin()->priority == findMinimumPriority(tasks), "Push: Minimum at %lu.", index);
+    }
+
+    passert(heap.getCount() == kNumTasks && heap.peekMin()->priority == findMinimumPriority(tasks), "Push: Count.");
+
+    pinfo("Push: Test Passed.");
+
+    // Pop a few tasks so that the heap has deep subtrees
+    for (size_t round = 0; round < 100; round += 1)
+    {
+        uint32_t expected = findMinimumPriority(tasks);
+
+        Task* task = heap.popMin();
+
+        passert(task->priority == expected && task->child == nullptr && task->rightSibling == nullptr && task->leftSiblingOrParent == nullptr, "Pop: Round %lu.", round);
+
+        task->isQueued = false;
+    }
+
+    // Remove and decrease the keys of random tasks, including the minimum one
+    size_t count = heap.getCount();
+
+    for (size_t round = 0; round < 1000; round += 1)
+    {
+        Task& task = tasks[static_cast<size_t>(rand()) % kNumTasks];
+
+        if (!task.isQueued)
+        {
+            continue;
+        }
+
+        if (round % 2 == 0)
+        {
+            Task* removed = round % 10 == 0 ? const_cast<Task*>(heap.peekMin()) : &task;
+
+            heap.remove(removed);
+
+            passert(removed->child == nullptr && removed->rightSibling == nullptr && removed->leftSiblingOrParent == nullptr, "Remove: Unlinked at round %lu.", round);
+
+            removed->isQueued = false;
+
+            count -= 1;
+        }
+        else
+        {
+            // The priority never wraps around, which would be an increase
+            task.priority -= std::min(task.priority, static_cast<uint32_t>(rand()) % 1000);
+
+            heap.decreaseKey(&task);
+        }
+
+        passert(heap.getCount() == count && heap.peekMin()->priority == findMinimumPriority(tasks), "Remove/Decrease Key: Round %lu.", round);
+    }
+
+    pinfo("Remove/Decrease Key: Test Passed.");
+
+    // Pop all tasks in order
+    uint32_t previous = 0;
+
+    for (size_t index = 0; index < count; index += 1)
+    {
+        Task* task = heap.popMin();
+
+        passert(task != nullptr && task->priority >= previous, "Pop All: Order at %lu.", index);
+
+        previous = task->priority;
+    }
+
+    passert(heap.isEmpty() && heap.getCount() == 0 && heap.peekMin() == nullptr && heap.popMin() == nullptr, "Pop All: Empty.");
+
+    pinfo("Pop All: Test Passed.");
+
+    // A task can be in a list and a heap at the same time
+    LinkedList<Task> list;
+
+    list.enqueue(&tasks[0]);
+
+    list.enqueue(&tasks[1]);
+
+    tasks[0].priority = 2;
+
+    tasks[1].priority = 1;
+
+    heap.push(&tasks[0]);
+
+    heap.push(&tasks[1]);
+
+    passert(heap.popMin() == &tasks[1] && list.dequeue() == &tasks[0] && heap.popMin() == &tasks[0] && list.dequeue() == &tasks[1], "List and Heap.");
+
+    pinfo("List and Heap: Test Passed.");
+
+    delete[] tasks;
+
+    pinfof("==== TEST PAIRING HEAP FINISHED ====\n");
+}
@@ -0,0 +1,20 @@
+//
+//  PairingHeapTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef PairingHeapTest_hpp
+#define PairingHeapTest_hpp
+
+#include "TestSuite.hpp"
+
+class PairingHeapTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* PairingHeapTest_hpp */
@@ -0,0 +1,287 @@
+//
+//  RedBlackTreeTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "RedBlackTreeTest.hpp"
+#include "RedBlackTree.hpp"
+#include "LinkedList.hpp"
+#include "Debug.hpp"
+#include <cstdlib>
+
+/// A memory region that is keyed by its start address, and can be in a list and a tree at the same time
+struct Region: Listable<Region>, TreeNode<Region>
+{
+    uint64_t start;
+
+    size_t sequence;
+
+    bool isInserted;
+
+    friend bool operator<(const Region& lhs, const Region& rhs)
+    {
+        return lhs.start < rhs.start;
+    }
+
+    friend bool operator<(const Region& lhs, uint64_t rhs)
+    {
+        return lhs.start < rhs;
+    }
+
+    friend bool operator<(uint64_t lhs, const Region& rhs)
+    {
+        return lhs < rhs.start;
+    }
+};
+
+/// The number of regions
+static constexpr size_t kNumRegions = 2000;
+
+///
+/// Verify the links and the colors of the given subtree
+///
+/// @param node The root of a subtree
+/// @param parent The expected parent of the root
+/// @return The number of black nodes on each path from the root to a leaf.
+///
+static size_t verifySubtree(const Region* node, const Region* parent)
+{
+    // Guard: A leaf is black
+    if (node == nullptr)
+    {
+        return 1;
+    }
+
+    passert(node->parent == parent, "The parent link is broken.");
+
+    passert(!node->isRed || ((node->leftChild == nullptr || !node->leftChild->isRed) && (node->rightChild == nullptr || !node->rightChild->isRed)), "A red node has a red child.");
+
+    size_t leftHeight = verifySubtree(node->leftChild, node);
+
+    size_t rightHeight = verifySubtree(node->rightChild, node);
+
+    passert(leftHeight == rightHeight, "The black heights are different.");
+
+    return leftHeight + (node->isRed ? 0 : 1);
+}
+
+///
+/// Verify the given tree against the array of regions
+///
+/// @param tree The tree to be verified
+/// @param regions The array of regions, some of which are inserted into the tree
+///
+static void verify(const RedBlackTree<Region>& tree, const Region* regions)
+{
+    const Region* root = tree.peekRoot();
+
+    passert(root == nullptr || !root->isRed, "The root is red.");
+
+    verifySubtree(root, nullptr);
+
+    // In-order traversal visits the inserted regions in order, and keeps the insertion order of the equal ones
+    size_t count = 0;
+
+    const Region* previous = nullptr;
+
+    tree.forEach([&](const Region* region) -> void
+    {
+        passert(region->isInserted, "Region %lu has been removed.", region->sequence);
+
+        passert(previous == nullptr || previous->start < region->start || (previous->start == region->start && previous->sequence < region->sequence), "Regions are out of order.");
+
+        previous = region;
+
+        count += 1;
+    });
+
+    size_t expected = 0;
+
+    for (size_t index = 0; index < kNumRegions; index += 1)
+    {
+        expected += regions[index].isInserted;
+    }
+
+    passert(count == expected && tree.getCount() == expected && tree.isEmpty() == (expected == 0), "The count is incorrect.");
+
+    passert(tree.peekMax() == previous, "The cached maximum is incorrect.");
+
+    // Reverse traversal visits the same regions
+    const Region* next = nullptr;
+
+    tree.reverseForEach([&](const Region* region) -> void
+    {
+        passert(RedBlackTree<Region>::findNext(region) == next, "The reverse traversal is broken.");
+
+        next = region;
+    });
+
+    passert(tree.peekMin() == next, "The cached minimum is incorrect.");
+}
+
+void RedBlackTreeTest::run()
+{
+    pinfof("==== TEST RED BLACK TREE STARTED ====\n");
+
+    auto* regions = new Region[kNumRegions];
+
+    RedBlackTree<Region> tree;
+
+    passert(tree.isEmpty() && tree.peekMin() == nullptr && tree.peekMax() == nullptr && tree.find(0UL) == nullptr && tree.lowerBound(0UL) == nullptr, "An empty tree.");
+
+    for (size_t index = 0; index < kNumRegions; index += 1)
+    {
+        regions[index].isInserted = false;
+    }
+
+    // Insert: Many regions share the same start address
+    for (size_t index = 0; index < kNumRegions; index += 1)
+    {
+        regions[index].start = static_cast<uint64_t>(rand() % 1000) * 0x1000;
+
+        regions[index].sequence = index;
+
+        regions[index].isInserted = true;
+
+        tree.insert(&regions[index]);
+
+        if (index % 100 == 0)
+        {
+            verify(tree, regions);
+        }
+    }
+
+    verify(tree, regions);
+
+    pinfo("Insert: Test Passed.");
+
+    // Lookup: Compare against a linear search
+    for (uint64_t address = 0; address <= 1001 * 0x1000; address += 0x800)
+    {
+        const Region* lowerBound = nullptr;
+
+        const Region* upperBound = nullptr;
+
+        for (size_t index = 0; index < kNumRegions; index += 1)
+        {
+            const Region* region = &regions[index];
+
+            // The first one among the equal regions has the smallest sequence
+            if (region->start >= address && (lowerBound == nullptr || region->start < lowerBound->start || (region->start == lowerBound->start && region->sequence < lowerBound->sequence)))
+            {
+                lowerBound = region;
+            }
+
+            if (region->start > address && (upperBound == nullptr || region->start < upperBound->start || (region->start == upperBound->start && region->sequence < upperBound->sequence)))
+            {
+                upperBound = region;
+            }
+        }
+
+        const Region* found = lowerBound != nullptr && lowerBound->start == address ? lowerBound : nullptr;
+
+        passert(tree.lowerBound(address) == lowerBound, "Lower Bound: Address = 0x%llx.", static_cast<unsigned long long>(address));
+
+        passert(tree.upperBound(address) == upperBound, "Upper Bound: Address = 0x%llx.", static_cast<unsigned long long>(address));
+
+        passert(tree.find(address) == found, "Find: Address = 0x%llx.", static_cast<unsigned long long>(address));
+    }
+
+    passert(tree.find(regions[0]) == tree.lowerBound(regions[0].start), "Find: A node as the key.");
+
+    pinfo("Lookup: Test Passed.");
+
+    // Remove random regions, including the minimum and the maximum ones
+    for (size_t round = 0; round < kNumRegions * 3 / 4; round += 1)
+    {
+        Region* region = &regions[static_cast<size_t>(rand()) % kNumRegions];
+
+        if (round % 10 == 0)
+        {
+            region = const_cast<Region*>(tree.peekMin());
+        }
+        else if (round % 10 == 1)
+        {
+            region = const_cast<Region*>(tree.peekMax());
+        }
+
+        if (!region->isInserted)
+        {
+            continue;
+        }
+
+        tree.remove(region);
+
+        region->isInserted = false;
+
+        passert(region->parent == nullptr && region->leftChild == nullptr && region->rightChild == nullptr, "Remove: Unlinked at round %lu.", round);
+
+        if (round % 50 == 0)
+        {
+            verify(tree, regions);
+        }
+    }
+
+    verify(tree, regions);
+
+    // Insert the removed regions again
+    for (size_t index = 0; index < kNumRegions; index += 1)
+    {
+        if (!regions[index].isInserted)
+        {
+            regions[index].sequence += kNumRegions;
+
+            regions[index].isInserted = true;
+
+            tree.insert(&regions[index]);
+        }
+    }
+
+    verify(tree, regions);
+
+    // Remove all regions in order
+    for (size_t index = 0; index < kNumRegions; index += 1)
+    {
+        Region* region = const_cast<Region*>(tree.peekMin());
+
+        tree.remove(region);
+
+        region->isInserted = false;
+    }
+
+    verify(tree, regions);
+
+    passert(tree.isEmpty() && tree.peekRoot() == nullptr && tree.peekMin() == nullptr && tree.peekMax() == nullptr, "Remove All: Empty.");
+
+    pinfo("Remove: Test Passed.");
+
+    // A region can be in a list and a tree at the same time
+    LinkedList<Region> list;
+
+    regions[0].start = 2;
+
+    regions[1].start = 1;
+
+    list.enqueue(&regions[0]);
+
+    list.enqueue(&regions[1]);
+
+    tree.insert(&regions[0]);
+
+    tree.insert(&regions[1]);
+
+    passert(tree.peekMin() == &regions[1] && tree.peekMax() == &regions[0] && list.peekHead() == &regions[0] && list.peekTail() == &regions[1], "List and Tree.");
+
+    tree.remove(&regions[1]);
+
+    passert(tree.find(1UL) == nullptr && tree.find(2UL) == &regions[0] && list.getCount() == 2, "List and Tree: Remove.");
+
+    pinfo("List and Tree: Test Passed.");
+
+    delete[] regions;
+
+    pinfof("==== TEST RED BLACK TREE FINISHED ====\n");
+}
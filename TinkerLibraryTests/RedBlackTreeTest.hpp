@@ -0,0 +1,20 @@
+//
+//  RedBlackTreeTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef RedBlackTreeTest_hpp
+#define RedBlackTreeTest_hpp
+
+#include "TestSuite.hpp"
+
+class RedBlackTreeTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* RedBlackTreeTest_hpp */
@@ -8,7 +8,130 @@
 
 #include "SignificantBitTest.hpp"
 #include "SignificantBit.hpp"
+#include "SignificantBitKernels.hpp"
 #include "Debug.hpp"
+#include <algorithm>
+#include <iterator>
+
+///
+/// Verify the batch kernels against the scalar finders on random integers and edge cases of the given type
+///
+template <typename T>
+static void testBatchKernels()
+{
+    // Cover every bit position along with a count that is not a multiple of any register width
+    static constexpr size_t kNumValues = 1000;
+
+    T values[kNumValues], powers[kNumValues], results[kNumValues];
+
+    uint32_t lsbs[kNumValues], msbs[kNumValues];
+
+    static constexpr T kMaxPowerOf2 = static_cast<T>(1) << (sizeof(T) * 8 - 1);
+
+    const T edges[] = { 0, 1, 2, 3, static_cast<T>(~0), kMaxPowerOf2, static_cast<T>(kMaxPowerOf2 - 1), static_cast<T>(kMaxPowerOf2 + 1) };
+
+    for (size_t index = 0; index < kNumValues; index += 1)
+    {
+        if (index < std::size(edges))
+        {
+            values[index] = edges[index];
+        }
+        else
+        {
+            uint64_t random = static_cast<uint64_t>(rand()) << 32 | rand();
+
+            values[index] = static_cast<T>(random >> (index % 64)) << (index % (sizeof(T) * 8));
+        }
+
+        // Inputs to the next power of 2 must be in the range of [1, 2^(N-1)]
+        powers[index] = std::min<T>(std::max<T>(values[index], 1), kMaxPowerOf2);
+    }
+
+    SignificantBitKernels<T>::findLeastSignificantBitIndices(values, lsbs, kNumValues);
+
+    SignificantBitKernels<T>::findMostSignificantBitIndices(values, msbs, kNumValues);
+
+    SignificantBitKernels<T>::findNextPowersOf2(powers, results, kNumValues);
+
+    for (size_t index = 0; index < kNumValues; index += 1)
+    {
+        passert(lsbs[index] == LSBFinder<T>()(values[index]), "Batch LSB%lu @%lu = 0x%llx", sizeof(T) * 8, index, static_cast<unsigned long long>(values[index]));
+
+        passert(msbs[index] == MSBFinder<T>()(values[index]), "Batch MSB%lu @%lu = 0x%llx", sizeof(T) * 8, index, static_cast<unsigned long long>(values[index]));
+
+        passert(results[index] == NextPowerOf2Finder<T>()(powers[index]), "Batch NP2%lu @%lu = 0x%llx", sizeof(T) * 8, index, static_cast<unsigned long long>(powers[index]));
+    }
+
+    // The next power of 2 can be computed in place
+    SignificantBitKernels<T>::findNextPowersOf2(powers, powers, kNumValues);
+
+    passert(std::equal(powers, powers + kNumValues, results), "Batch NP2%lu in place", sizeof(T) * 8);
+}
+
+///
+/// Verify the finders and the population counter of the given wide integer type against its 64-bit words
+///
+template <typename T>
+static void testWideFinders()
+{
+    static constexpr uint32_t kNumBits = sizeof(T) * 8;
+
+    static constexpr T kHighestBit = static_cast<T>(1) << (kNumBits - 1);
+
+    // A single bit, and the same bit along with the highest one
+    for (uint32_t index = 0; index < kNumBits; index += 1)
+    {
+        T value = static_cast<T>(1) << index;
+
+        passert(LSBFinder<T>()(value) == index && MSBFinder<T>()(value) == index && PopulationCounter<T>()(value) == 1, "Wide%u: Bit %u.", kNumBits, index);
+
+        passert(LSBFinder<T>()(value | kHighestBit) == index && MSBFinder<T>()(value | kHighestBit) == kNumBits - 1, "Wide%u: Bit %u and MSB.", kNumBits, index);
+
+        // Borrows propagate across words
+        passert(PopulationCounter<T>()(value - 1) == index && (value & -value) == value, "Wide%u: Low bits below %u.", kNumBits, index);
+
+        if (index < kNumBits - 1)
+        {
+            passert(NextPowerOf2Finder<T>()(value + 1) == (value << 1) || index == 0, "Wide%u: NP2 of bit %u.", kNumBits, index);
+        }
+    }
+
+    // Random words
+    for (uint32_t trial = 0; trial < 10000; trial += 1)
+    {
+        T value = 0;
+
+        for (uint32_t word = 0; word < kNumBits / 64; word += 1)
+        {
+            uint64_t random = static_cast<uint64_t>(rand()) << 32 | rand();
+
+            // Leave some words empty, so that the finders must skip them
+            value |= static_cast<T>(rand() % 2 == 0 ? 0 : random >> (trial % 64)) << (word * 64);
+        }
+
+        uint32_t lsb = 0, msb = 0, count = 0;
+
+        bool found = false;
+
+        for (uint32_t word = 0; word < kNumBits / 64; word += 1)
+        {
+            uint64_t bits = getWideIntegerWord(value, word);
+
+            if (bits != 0)
+            {
+                lsb = found ? lsb : word * 64 + LSBFinder<uint64_t>()(bits);
+
+                msb = word * 64 + MSBFinder<uint64_t>()(bits);
+
+                found = true;
+            }
+
+            count += PopulationCounter<uint64_t>()(bits);
+        }
+
+        passert(LSBFinder<T>()(value) == lsb && MSBFinder<T>()(value) == msb && PopulationCounter<T>()(value) == count, "Wide%u: Random trial %u.", kNumBits, trial);
+    }
+}
 
 void SignificantBitTest::run()
 {
@@ -167,6 +290,65 @@ void SignificantBitTest::run()
 
     pinfo("MSB*/LSB* IntMax: Test Passed.");
 
+    // Compile Time Evaluation
+    static_assert(LSBFinder<uint64_t>()(0x8000000000000000ULL) == 63 && MSBFinder<uint64_t>()(0x10) == 4, "LSB64/MSB64 constexpr");
+
+    static_assert(LSBFinder<uint8_t>()(0x80) == 7 && MSBFinder<uint8_t>()(0x01) == 0, "LSB8/MSB8 constexpr");
+
+    static_assert(PortableLSBFinder<uint32_t>()(0x100) == 8 && PortableMSBFinder<uint16_t>()(0x7FFF) == 14, "Portable constexpr");
+
+    static_assert(PortableLSBFinder<uint64_t>()(1ULL << 63) == 63 && PortableMSBFinder<uint64_t>()(0x1FFFFFFFFFF) == 40 && PortableMSBFinder<uint32_t>()(~0u) == 31, "Generated de Bruijn tables");
+
+    static_assert(NextPowerOf2Finder<uint32_t>()(33) == 64 && PopulationCounter<uint64_t>()(~0ULL) == 64, "NP2/PopCount constexpr");
+
+    static_assert(LSBFinder<UInt256>()(static_cast<UInt256>(1) << 200) == 200 && MSBFinder<UInt256>()(~static_cast<UInt256>(0)) == 255, "LSB256/MSB256 constexpr");
+
+    static_assert(PopulationCounter<UInt256>()(~static_cast<UInt256>(0) >> 3) == 253 && MSBFinder<UInt128>()(1) == 0, "PopCount256/MSB128 constexpr");
+
+    // Portable Implementation: Must agree with the selected backend
+    for (uint32_t index = 0; index < 100000; index += 1)
+    {
+        uint64_t value = (static_cast<uint64_t>(rand()) << 32 | rand()) >> (index % 64);
+
+        passert(PortableLSBFinder<uint64_t>()(value) == LSBFinder<uint64_t>()(value), "Portable LSB64 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableLSBFinder<uint32_t>()(value) == LSBFinder<uint32_t>()(value), "Portable LSB32 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableLSBFinder<uint16_t>()(value) == LSBFinder<uint16_t>()(value), "Portable LSB16 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableLSBFinder<uint8_t>()(value) == LSBFinder<uint8_t>()(value), "Portable LSB8 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableMSBFinder<uint64_t>()(value) == MSBFinder<uint64_t>()(value), "Portable MSB64 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableMSBFinder<uint32_t>()(value) == MSBFinder<uint32_t>()(value), "Portable MSB32 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableMSBFinder<uint16_t>()(value) == MSBFinder<uint16_t>()(value), "Portable MSB16 = 0x%llx", static_cast<unsigned long long>(value));
+
+        passert(PortableMSBFinder<uint8_t>()(value) == MSBFinder<uint8_t>()(value), "Portable MSB8 = 0x%llx", static_cast<unsigned long long>(value));
+    }
+
+    pinfo("Portable Implementation: Test Passed.");
+
+    // Batch Kernels: Must agree with the scalar finders
+    testBatchKernels<uint8_t>();
+
+    testBatchKernels<uint16_t>();
+
+    testBatchKernels<uint32_t>();
+
+    testBatchKernels<uint64_t>();
+
+    pinfo("Batch Kernels: Test Passed.");
+
+    // Wide Integers: Must agree with the finders on each 64-bit word
+    testWideFinders<UInt128>();
+
+    testWideFinders<WideUnsignedInteger<2>>();
+
+    testWideFinders<UInt256>();
+
+    pinfo("Wide Integers: Test Passed.");
+
     // Next Power of 2 Tests
     for (uint64_t index = 0; index < 63; index += 1)
     {
@@ -0,0 +1,174 @@
+//
+//  SkipListTest.cpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#include "SkipListTest.hpp"
+#include "SkipList.hpp"
+#include "Debug.hpp"
+#include <cstdlib>
+
+/// A timer that expires at a deadline, and remembers when it was inserted
+template <size_t NumLevels>
+struct Timer: SkipListable<Timer<NumLevels>, NumLevels>
+{
+    uint32_t deadline;
+
+    uint32_t sequence;
+
+    friend bool operator<(const Timer& lhs, const Timer& rhs)
+    {
+        return lhs.deadline < rhs.deadline;
+    }
+
+    friend bool operator>(const Timer& lhs, const Timer& rhs)
+    {
+        return rhs < lhs;
+    }
+};
+
+///
+/// Verify that the list is sorted, that timers with the same deadline keep their insertion order, and that the metadata is consistent
+///
+/// @param timers A skip list of timers
+/// @param expected The expected number of timers in the list
+/// @param name The name of the check
+///
+template <typename TimerType, typename Comparator>
+static void verify(const SkipList<TimerType, Comparator>& timers, size_t expected, const char* name)
+{
+    size_t count = 0;
+
+    const auto* previous = timers.peekHead();
+
+    timers.forEach([&](const TimerType* timer) -> void
+    {
+        passert(Comparator()(*previous, *timer) || (!Comparator()(*timer, *previous) && timer->sequence >= previous->sequence), "%s: Order at %lu.", name, count);
+
+        passert(timer->level > 0, "%s: Level at %lu.", name, count);
+
+        previous = timer;
+
+        count += 1;
+    });
+
+    passert(count == expected && timers.getCount() == expected, "%s: Count.", name);
+
+    passert(timers.peekTail() == (expected == 0 ? nullptr : previous), "%s: Tail.", name);
+
+    passert(timers.isEmpty() == (expected == 0), "%s: Empty.", name);
+}
+
+///
+/// Verify the skip list with random insertions and removals
+///
+/// @tparam NumLevels Specify the maximum number of levels of each timer
+/// @tparam Comparator Specify the comparator
+/// @param numTimers The number of timers
+///
+template <size_t NumLevels, typename Comparator>
+static void testSkipList(size_t numTimers)
+{
+    using TimerType = Timer<NumLevels>;
+
+    auto* timers = new TimerType[numTimers];
+
+    SkipList<TimerType, Comparator> list;
+
+    // Many timers share the same deadline
+    for (size_t index = 0; index < numTimers; index += 1)
+    {
+        timers[index].deadline = static_cast<uint32_t>(rand()) % (numTimers / 4 + 1);
+
+        timers[index].sequence = static_cast<uint32_t>(index);
+
+        list.insert(&timers[index]);
+    }
+
+    verify(list, numTimers, "Insert");
+
+    // Remove every third timer, including the head and the tail
+    size_t remaining = numTimers;
+
+    for (size_t index = 0; index < numTimers; index += 3)
+    {
+        list.remove(&timers[index]);
+
+        passert(timers[index].level == 0 && timers[index].links[0].prev == nullptr && timers[index].links[0].next == nullptr, "Remove: Unlinked %lu.", index);
+
+        remaining -= 1;
+    }
+
+    list.remove(const_cast<TimerType*>(list.peekHead()));
+
+    list.remove(const_cast<TimerType*>(list.peekTail()));
+
+    remaining -= 2;
+
+    verify(list, remaining, "Remove");
+
+    // Reinsert the removed timers as the latest ones
+    uint32_t sequence = static_cast<uint32_t>(numTimers);
+
+    for (size_t index = 0; index < numTimers; index += 1)
+    {
+        if (timers[index].level == 0)
+        {
+            timers[index].sequence = sequence;
+
+            sequence += 1;
+
+            list.insert(&timers[index]);
+        }
+    }
+
+    verify(list, numTimers, "Reinsert");
+
+    // Dequeue all timers in order
+    const TimerType* previous = nullptr;
+
+    for (size_t index = 0; index < numTimers; index += 1)
+    {
+        TimerType* timer = list.dequeue();
+
+        passert(timer != nullptr && timer->level == 0, "Dequeue: Timer %lu.", index);
+
+        passert(previous == nullptr || !Comparator()(*timer, *previous), "Dequeue: Order at %lu.", index);
+
+        passert(previous == nullptr || Comparator()(*previous, *timer) || timer->sequence > previous->sequence, "Dequeue: Stability at %lu.", index);
+
+        previous = timer;
+    }
+
+    passert(list.dequeue() == nullptr && list.peekHead() == nullptr && list.peekTail() == nullptr && list.isEmpty(), "Dequeue: Empty.");
+
+    // The list is usable after being emptied
+    list.insert(&timers[0]);
+
+    verify(list, 1, "Single");
+
+    passert(list.dequeue() == &timers[0] && list.isEmpty(), "Single: Dequeue.");
+
+    delete[] timers;
+}
+
+void SkipListTest::run()
+{
+    pinfof("==== TEST SKIP LIST STARTED ====\n");
+
+    // A few levels that fill up quickly
+    testSkipList<1, std::less<>>(100);
+
+    testSkipList<4, std::less<>>(5000);
+
+    testSkipList<12, std::less<>>(5000);
+
+    testSkipList<12, std::greater<>>(5000);
+
+    pinfo("Random Insertions and Removals: Test Passed.");
+
+    pinfof("==== TEST SKIP LIST FINISHED ====\n");
+}
@@ -0,0 +1,20 @@
+//
+//  SkipListTest.hpp
+//  TinkerLibrary
+//
+//  Created by FireWolf on 10/17/26.
+//  Copyright © 2026 FireWolf. All rights reserved.
+//
+
+#ifndef SkipListTest_hpp
+#define SkipListTest_hpp
+
+#include "TestSuite.hpp"
+
+class SkipListTest: public TestSuite
+{
+public:
+    void run() override;
+};
+
+#endif /* SkipListTest_hpp */
@@ -8,6 +8,282 @@
 
 #include "StaticBitVectorTest.hpp"
 #include "StaticBitVector.hpp"
+#include "StaticBitVectorRankCache.hpp"
+#include "StaticBitVectorCountingIndex.hpp"
+#include <ranges>
+
+///
+/// Verify a bit vector whose storage unit is wider than 64 bits against the same operations on 64-bit storage units
+///
+template <typename StorageUnit>
+static void testWideStorageUnit()
+{
+    static constexpr size_t kNumBits = 1000;
+
+    StaticBitVector<kNumBits, StorageUnit> vector, other;
+
+    StaticBitVector<kNumBits, uint64_t> reference, otherReference;
+
+    vector.initWithZeros();
+
+    reference.initWithZeros();
+
+    other.initWithZeros();
+
+    otherReference.initWithZeros();
+
+    // Edge bits of each word and each block, along with random ones
+    for (size_t index = 0; index < 300; index += 1)
+    {
+        size_t bit = index < 16 ? index * 63 : static_cast<size_t>(rand()) % kNumBits;
+
+        vector.setBit(bit);
+
+        reference.setBit(bit);
+
+        other.setBit((bit * 7) % kNumBits);
+
+        otherReference.setBit((bit * 7) % kNumBits);
+    }
+
+    // A range that spans several blocks and ends in the middle of a word
+    vector.clearBits(ClosedRange<size_t>(250, 700));
+
+    reference.clearBits(ClosedRange<size_t>(250, 700));
+
+    vector.setBits(ClosedRange<size_t>(400, 530));
+
+    reference.setBits(ClosedRange<size_t>(400, 530));
+
+    for (size_t index = 0; index < kNumBits; index += 1)
+    {
+        passert(vector.getBit(index) == reference.getBit(index), "Wide%lu: Bit %lu.", sizeof(StorageUnit) * 8, index);
+
+        passert(vector.findNextSetBit(index) == reference.findNextSetBit(index), "Wide%lu: Next set bit from %lu.", sizeof(StorageUnit) * 8, index);
+
+        passert(vector.findNextZeroBit(index) == reference.findNextZeroBit(index), "Wide%lu: Next zero bit from %lu.", sizeof(StorageUnit) * 8, index);
+    }
+
+    passert(vector.count() == reference.count(), "Wide%lu: Count.", sizeof(StorageUnit) * 8);
+
+    passert(vector.findLeastSignificantBitIndex() == reference.findLeastSignificantBitIndex(), "Wide%lu: LSB.", sizeof(StorageUnit) * 8);
+
+    passert(vector.findMostSignificantBitIndex() == reference.findMostSignificantBitIndex(), "Wide%lu: MSB.", sizeof(StorageUnit) * 8);
+
+    passert(vector.findMostSignificantBitIndexWithRange(ClosedRange<size_t>(200, 399)) == reference.findMostSignificantBitIndexWithRange(ClosedRange<size_t>(200, 399)), "Wide%lu: MSB with range.", sizeof(StorageUnit) * 8);
+
+    passert(vector.select(vector.count() / 2) == reference.select(reference.count() / 2), "Wide%lu: Select.", sizeof(StorageUnit) * 8);
+
+    // Bulk operations split each block into 64-bit words
+    vector ^= other;
+
+    reference ^= otherReference;
+
+    passert(vector.count() == reference.count() && vector.findMostSignificantBitIndex() == reference.findMostSignificantBitIndex(), "Wide%lu: XOR.", sizeof(StorageUnit) * 8);
+
+    vector.andNot(other);
+
+    reference.andNot(otherReference);
+
+    passert(vector.count() == reference.count() && !vector.intersects(other), "Wide%lu: ANDNOT.", sizeof(StorageUnit) * 8);
+
+    // Nonexistent bits in the last block are never reported as zero bits
+    vector.initWithOnes();
+
+    passert(vector.findFirstZeroBitIndex() == -1 && vector.count() == kNumBits, "Wide%lu: All ones.", sizeof(StorageUnit) * 8);
+
+    size_t sum = 0;
+
+    for (size_t index : other)
+    {
+        sum += index;
+    }
+
+    size_t expected = 0;
+
+    for (size_t index : otherReference)
+    {
+        expected += index;
+    }
+
+    passert(sum == expected, "Wide%lu: Iterator.", sizeof(StorageUnit) * 8);
+}
+
+///
+/// Verify bit vectors created at compile time against the same vectors filled at runtime
+///
+template <typename StorageUnit>
+static void testConstantInitialization()
+{
+    static constexpr size_t kNumBits = 1000;
+
+    // Constant initialization fails to compile if any of the factories is not a constant expression
+    static constinit StaticBitVector<kNumBits, StorageUnit> zeros = StaticBitVector<kNumBits, StorageUnit>::createWithZeros();
+
+    static constinit StaticBitVector<kNumBits, StorageUnit> ones = StaticBitVector<kNumBits, StorageUnit>::createWithOnes();
+
+    static constinit StaticBitVector<kNumBits, StorageUnit> bits = StaticBitVector<kNumBits, StorageUnit>::createWithBits(0, 63, 64, 500, 999);
+
+    static constinit StaticBitVector<kNumBits, StorageUnit> ranges = StaticBitVector<kNumBits, StorageUnit>::createWithRanges(ClosedRange<size_t>(0, 255), ClosedRange<size_t>(100, 300), ClosedRange<size_t>(900, 999));
+
+    StaticBitVector<kNumBits, StorageUnit> reference;
+
+    reference.initWithZeros();
+
+    passert(zeros.count() == 0 && zeros.findLeastSignificantBitIndex() == -1, "Constexpr%lu: Zeros.", sizeof(StorageUnit) * 8);
+
+    // Nonexistent bits in the last block must be clear
+    passert(ones.count() == kNumBits && ones.findFirstZeroBitIndex() == -1 && ones.findMostSignificantBitIndex() == kNumBits - 1, "Constexpr%lu: Ones.", sizeof(StorageUnit) * 8);
+
+    for (size_t index : {0, 63, 64, 500, 999})
+    {
+        reference.setBit(index);
+    }
+
+    passert(bits.count() == 5, "Constexpr%lu: Bits.", sizeof(StorageUnit) * 8);
+
+    for (size_t index = 0; index < kNumBits; index += 1)
+    {
+        passert(bits.getBit(index) == reference.getBit(index), "Constexpr%lu: Bit %lu.", sizeof(StorageUnit) * 8, index);
+    }
+
+    reference.initWithZeros();
+
+    reference.setBits(ClosedRange<size_t>(0, 300));
+
+    reference.setBits(ClosedRange<size_t>(900, 999));
+
+    passert(ranges.count() == 401, "Constexpr%lu: Ranges.", sizeof(StorageUnit) * 8);
+
+    for (size_t index = 0; index < kNumBits; index += 1)
+    {
+        passert(ranges.getBit(index) == reference.getBit(index), "Constexpr%lu: Range Bit %lu.", sizeof(StorageUnit) * 8, index);
+    }
+}
+
+///
+/// Verify the counting index against the linear scans of the bit vector after random modifications through the index
+///
+template <size_t NumBits, typename StorageUnit>
+static void testCountingIndex()
+{
+    static StaticBitVector<NumBits, StorageUnit> vector;
+
+    vector.initWithZeros();
+
+    StaticBitVectorCountingIndex<NumBits, StorageUnit> index(vector);
+
+    passert(index.count() == 0 && index.select(0) == -1 && index.findFirstWindowWithSetBits(64, 1) == -1, "Counting%lu: Empty.", sizeof(StorageUnit) * 8);
+
+    passert(index.findFirstWindowWithZeroBits(64, 64) == 0, "Counting%lu: Empty Window.", sizeof(StorageUnit) * 8);
+
+    uint32_t seed = 2020;
+
+    for (size_t round = 0; round < 200; round += 1)
+    {
+        seed = seed * 1103515245 + 12345;
+
+        size_t bit = (seed >> 8) % NumBits;
+
+        size_t length = (seed >> 20) % 300 + 1;
+
+        // Mostly single bits, and occasionally ranges that span several blocks
+        switch (round % 5)
+        {
+            case 0:
+                index.setBits(ClosedRange<size_t>(bit, std::min(bit + length, NumBits) - 1));
+
+                break;
+
+            case 1:
+                index.clearBits(ClosedRange<size_t>(bit, std::min(bit + length, NumBits) - 1));
+
+                break;
+
+            case 2:
+                index.clearBit(bit);
+
+                break;
+
+            default:
+                index.setBit(bit);
+
+                break;
+        }
+
+        passert(index.count() == vector.count(), "Counting%lu: Count at round %lu.", sizeof(StorageUnit) * 8, round);
+    }
+
+    // Out-of-bounds modifications have no effect
+    index.setBit(NumBits);
+
+    index.setBits(ClosedRange<size_t>(NumBits - 1, NumBits));
+
+    passert(index.count() == vector.count(), "Counting%lu: Invalid modifications.", sizeof(StorageUnit) * 8);
+
+    for (size_t bit = 0; bit <= NumBits; bit += 1)
+    {
+        passert(index.rank(bit) == vector.rank(bit), "Counting%lu: Rank %lu.", sizeof(StorageUnit) * 8, bit);
+
+        passert(index.select(bit) == vector.select(bit), "Counting%lu: Select %lu.", sizeof(StorageUnit) * 8, bit);
+    }
+
+    for (size_t lowerBound = 0; lowerBound < NumBits; lowerBound += 37)
+    {
+        for (size_t upperBound = lowerBound; upperBound < NumBits; upperBound += 101)
+        {
+            size_t expected = 0;
+
+            for (size_t bit = lowerBound; bit <= upperBound; bit += 1)
+            {
+                expected += vector.getBit(bit);
+            }
+
+            passert(index.countWithRange(ClosedRange<size_t>(lowerBound, upperBound)) == expected, "Counting%lu: Range [%lu, %lu].", sizeof(StorageUnit) * 8, lowerBound, upperBound);
+        }
+    }
+
+    passert(index.countWithRange(ClosedRange<size_t>(0, NumBits)) == 0, "Counting%lu: Invalid Range.", sizeof(StorageUnit) * 8);
+
+    // Windows: The first one that has enough bits is found, including the shorter last window
+    for (size_t length : {1UL, 64UL, 100UL, 256UL, NumBits})
+    {
+        for (size_t count : {1UL, 10UL, 60UL})
+        {
+            ssize_t expectedSet = -1, expectedZero = -1;
+
+            for (size_t start = 0; start < NumBits && (expectedSet < 0 || expectedZero < 0); start += length)
+            {
+                size_t end = std::min(start + length, NumBits);
+
+                size_t numSetBits = vector.rank(end) - vector.rank(start);
+
+                if (expectedSet < 0 && numSetBits >= count)
+                {
+                    expectedSet = static_cast<ssize_t>(start);
+                }
+
+                if (expectedZero < 0 && end - start - numSetBits >= count)
+                {
+                    expectedZero = static_cast<ssize_t>(start);
+                }
+            }
+
+            passert(index.findFirstWindowWithSetBits(length, count) == expectedSet, "Counting%lu: Set Window %lu/%lu.", sizeof(StorageUnit) * 8, length, count);
+
+            passert(index.findFirstWindowWithZeroBits(length, count) == expectedZero, "Counting%lu: Zero Window %lu/%lu.", sizeof(StorageUnit) * 8, length, count);
+        }
+    }
+
+    passert(index.findFirstWindowWithSetBits(0, 0) == -1, "Counting%lu: Empty Window Length.", sizeof(StorageUnit) * 8);
+
+    // Direct modifications require a rebuild
+    vector.initWithOnes();
+
+    index.rebuild();
+
+    passert(index.count() == NumBits && index.select(NumBits - 1) == NumBits - 1 && index.findFirstWindowWithZeroBits(NumBits, 1) == -1, "Counting%lu: Rebuild.", sizeof(StorageUnit) * 8);
+}
 
 void StaticBitVectorTest::run()
 {
@@ -100,6 +376,21 @@ void StaticBitVectorTest::run()
 
     pinfo("InitWithOnes: Test Passed.");
 
+    // The last block is fully used if the number of bits is a multiple of the block width
+    StaticBitVector<16, uint8_t> vector2;
+
+    vector2.initWithOnes();
+
+    passert(vector2.blocks[1].flatten() == 0xFF, "Check the raw value of block 1.");
+
+    passert(vector2.findMostSignificantBitIndex() == 15, "Find MSB after init with ones.");
+
+    vector2.initWithZeros();
+
+    passert(vector2.findMostSignificantBitIndex() == -1, "Find MSB in an empty vector.");
+
+    pinfo("InitWithOnes: Test Passed.");
+
     // Test Set/Clear
     vector.initWithZeros();
 
@@ -158,5 +449,454 @@ void StaticBitVectorTest::run()
 
     pinfo("LSB/MSB: Test Passed.");
 
+    // Test Zero Bits & Next Bits
+    // Bits : 1 0 1 0 | 1 1 0 0 1 0 0 0
+    // Index: B A 9 8 | 7 6 5 4 3 2 1 0
+    passert(vector.findFirstZeroBitIndex() == 0, "Find the first zero bit.");
+
+    passert(vector.findFirstZeroBitIndexWithRange({6, 11}) == 8, "Find the first zero bit with range [6, 11].");
+
+    passert(vector.findFirstZeroBitIndexWithRange({6, 7}) == -1, "Find the first zero bit with range [6, 7].");
+
+    passert(vector.findNextSetBit(0) == 3, "Find the next set bit from 0.");
+
+    passert(vector.findNextSetBit(3) == 3, "Find the next set bit from 3.");
+
+    passert(vector.findNextSetBit(4) == 6, "Find the next set bit from 4.");
+
+    passert(vector.findNextSetBit(8) == 9, "Find the next set bit from 8.");
+
+    passert(vector.findNextSetBit(12) == -1, "Find the next set bit from an invalid index.");
+
+    passert(vector.findNextZeroBit(6) == 8, "Find the next zero bit from 6.");
+
+    passert(vector.findNextZeroBit(11) == -1, "Find the next zero bit from 11.");
+
+    // Nonexistent bits in the last block must never be reported as zero bits
+    vector.initWithOnes();
+
+    passert(vector.findFirstZeroBitIndex() == -1, "Find the first zero bit after init with ones.");
+
+    passert(vector.findNextZeroBit(5) == -1, "Find the next zero bit after init with ones.");
+
+    vector.clearBit(10);
+
+    passert(vector.findFirstZeroBitIndex() == 10, "Find the first zero bit after clearing bit 10.");
+
+    passert(vector.findNextSetBit(10) == 11, "Find the next set bit from 10.");
+
+    // Compare against the naive implementation
+    StaticBitVector<200, uint64_t> vector3;
+
+    vector3.initWithZeros();
+
+    for (size_t index = 0; index < 200; index += 3)
+    {
+        vector3.setBit(index * 7 % 200);
+    }
+
+    for (size_t from = 0; from < 200; from += 1)
+    {
+        ssize_t nextSetBit = -1, nextZeroBit = -1;
+
+        for (size_t index = from; index < 200; index += 1)
+        {
+            if (nextSetBit < 0 && vector3.containsBit(index))
+            {
+                nextSetBit = static_cast<ssize_t>(index);
+            }
+
+            if (nextZeroBit < 0 && !vector3.containsBit(index))
+            {
+                nextZeroBit = static_cast<ssize_t>(index);
+            }
+        }
+
+        passert(vector3.findNextSetBit(from) == nextSetBit, "Find the next set bit from %lu.", from);
+
+        passert(vector3.findNextZeroBit(from) == nextZeroBit, "Find the next zero bit from %lu.", from);
+    }
+
+    pinfo("Zero Bits & Next Bits: Test Passed.");
+
+    // Test Set/Clear Range
+    vector3.initWithZeros();
+
+    vector3.setRange(5, 3);
+
+    passert(vector3.blocks[0].flatten() == 0xE0, "Set a run within a block.");
+
+    vector3.setRange(60, 80);
+
+    for (size_t index = 0; index < 200; index += 1)
+    {
+        bool expected = (index >= 5 && index < 8) || (index >= 60 && index < 140);
+
+        passert(vector3.containsBit(index) == expected, "Set a run across blocks: Check bit %lu.", index);
+    }
+
+    vector3.clearRange(64, 64);
+
+    for (size_t index = 0; index < 200; index += 1)
+    {
+        bool expected = (index >= 5 && index < 8) || (index >= 60 && index < 64) || (index >= 128 && index < 140);
+
+        passert(vector3.containsBit(index) == expected, "Clear a run across blocks: Check bit %lu.", index);
+    }
+
+    vector3.setRange(190, 11);
+
+    passert(!vector3.containsBit(190), "Setting a run that exceeds the end of the vector has no effect.");
+
+    vector3.setRange(190, 10);
+
+    passert(vector3.findMostSignificantBitIndex() == 199, "Set a run that ends at the last bit.");
+
+    pinfo("Set/Clear Range: Test Passed.");
+
+    // Test Contiguous Zero Runs
+    // Set Bits: [5, 7], [60, 63], [128, 139], [190, 199]
+    passert(vector3.findContiguousZeroRun(1) == 0, "Find a run of 1 zero bit.");
+
+    passert(vector3.findContiguousZeroRun(5) == 0, "Find a run of 5 zero bits.");
+
+    passert(vector3.findContiguousZeroRun(6) == 8, "Find a run of 6 zero bits.");
+
+    passert(vector3.findContiguousZeroRun(6, 16) == 16, "Find a run of 6 zero bits aligned to 16.");
+
+    passert(vector3.findContiguousZeroRun(52) == 8, "Find a run of 52 zero bits.");
+
+    passert(vector3.findContiguousZeroRun(53) == 64, "Find a run of 53 zero bits.");
+
+    passert(vector3.findContiguousZeroRun(64, 64) == 64, "Find a run of 64 zero bits aligned to 64.");
+
+    passert(vector3.findContiguousZeroRun(50, 32) == 64, "Find a run of 50 zero bits aligned to 32.");
+
+    passert(vector3.findContiguousZeroRun(53, 10) == 70, "Find a run of 53 zero bits aligned to 10.");
+
+    passert(vector3.findContiguousZeroRun(60, 10) == -1, "Find a run of 60 zero bits aligned to 10.");
+
+    passert(vector3.findContiguousZeroRun(65) == -1, "Find a run of 65 zero bits.");
+
+    passert(vector3.findContiguousZeroRun(0) == -1, "Find an empty run.");
+
+    vector3.initWithZeros();
+
+    passert(vector3.findContiguousZeroRun(200) == 0, "Find a run that covers the whole vector.");
+
+    vector3.setBit(0);
+
+    passert(vector3.findContiguousZeroRun(100, 128) == -1, "Find a run that does not fit after alignment.");
+
+    pinfo("Contiguous Zero Runs: Test Passed.");
+
+    // Test Set/Clear/Check Bits in Range
+    vector3.initWithZeros();
+
+    vector3.setBits(ClosedRange<size_t>(3, 130));
+
+    passert(vector3.allSet(ClosedRange<size_t>(3, 130)), "All bits in [3, 130] are set.");
+
+    passert(vector3.allSet(ClosedRange<size_t>(64, 127)), "All bits in [64, 127] are set.");
+
+    passert(!vector3.allSet(ClosedRange<size_t>(2, 130)), "Bit 2 is not set.");
+
+    passert(!vector3.allSet(ClosedRange<size_t>(3, 131)), "Bit 131 is not set.");
+
+    passert(vector3.noneSet(ClosedRange<size_t>(0, 2)), "No bit in [0, 2] is set.");
+
+    passert(vector3.noneSet(ClosedRange<size_t>(131, 199)), "No bit in [131, 199] is set.");
+
+    passert(!vector3.noneSet(ClosedRange<size_t>(130, 199)), "Bit 130 is set.");
+
+    vector3.clearBits(ClosedRange<size_t>(10, 127));
+
+    passert(vector3.allSet(ClosedRange<size_t>(3, 9)), "All bits in [3, 9] are set.");
+
+    passert(vector3.noneSet(ClosedRange<size_t>(10, 127)), "No bit in [10, 127] is set.");
+
+    passert(vector3.allSet(ClosedRange<size_t>(128, 130)), "All bits in [128, 130] are set.");
+
+    passert(!vector3.allSet(ClosedRange<size_t>(128, 200)), "Check an invalid range.");
+
+    passert(!vector3.noneSet(ClosedRange<size_t>(190, 200)), "Check an invalid range.");
+
+    vector3.setBits(ClosedRange<size_t>(199, 200));
+
+    passert(!vector3.containsBit(199), "Setting an invalid range has no effect.");
+
+    vector3.initWithOnes();
+
+    passert(vector3.allSet(ClosedRange<size_t>(0, 199)), "All bits are set after init with ones.");
+
+    pinfo("Set/Clear/Check Bits in Range: Test Passed.");
+
+    // Test Count/Rank/Select
+    passert(vector3.count() == 200, "Count bits after init with ones.");
+
+    vector3.initWithZeros();
+
+    passert(vector3.count() == 0, "Count bits after init with zeros.");
+
+    passert(vector3.select(0) == -1, "Select in an empty vector.");
+
+    for (size_t index = 0; index < 200; index += 1)
+    {
+        if (index % 3 == 0 || (index >= 64 && index < 100))
+        {
+            vector3.setBit(index);
+        }
+    }
+
+    StaticBitVectorRankCache<200, uint64_t, 2> cache(vector3);
+
+    size_t count = 0;
+
+    for (size_t index = 0; index < 200; index += 1)
+    {
+        passert(vector3.rank(index) == count, "Rank of bit %lu.", index);
+
+        passert(cache.rank(index) == count, "Cached rank of bit %lu.", index);
+
+        if (vector3.containsBit(index))
+        {
+            passert(vector3.select(count) == static_cast<ssize_t>(index), "Select the %lu-th bit.", count);
+
+            passert(cache.select(count) == static_cast<ssize_t>(index), "Cached select the %lu-th bit.", count);
+
+            count += 1;
+        }
+    }
+
+    passert(vector3.count() == count, "Count bits.");
+
+    passert(vector3.rank(200) == count, "Rank of an out-of-bounds index.");
+
+    passert(vector3.select(count) == -1, "Select an out-of-bounds bit.");
+
+    passert(cache.count() == count, "Cached count bits.");
+
+    passert(cache.select(count) == -1, "Cached select an out-of-bounds bit.");
+
+    // The cache reflects the vector after being rebuilt
+    vector3.clearBits(ClosedRange<size_t>(0, 127));
+
+    cache.rebuild();
+
+    passert(cache.rank(128) == 0, "Cached rank after rebuild.");
+
+    passert(cache.select(0) == 129, "Cached select after rebuild.");
+
+    // The cache stays in sync if the vector is modified through the cache
+    cache.setBit(0);
+
+    cache.setBit(0);
+
+    cache.clearBit(129);
+
+    cache.clearBit(129);
+
+    cache.setBit(199);
+
+    cache.clearBit(200);
+
+    count = 0;
+
+    for (size_t index = 0; index < 200; index += 1)
+    {
+        passert(cache.rank(index) == vector3.rank(index), "Cached rank of bit %lu after updates.", index);
+
+        if (vector3.containsBit(index))
+        {
+            passert(cache.select(count) == static_cast<ssize_t>(index), "Cached select the %lu-th bit after updates.", count);
+
+            count += 1;
+        }
+    }
+
+    passert(cache.count() == vector3.count() && cache.count() == count, "Cached count bits after updates.");
+
+    pinfo("Count/Rank/Select: Test Passed.");
+
+    // Test Counting Index
+    testCountingIndex<1000, uint8_t>();
+
+    testCountingIndex<1000, uint64_t>();
+
+    testCountingIndex<4096, uint64_t>();
+
+    testCountingIndex<1000, UInt256>();
+
+    pinfo("Counting Index: Test Passed.");
+
+    // Test Iterate Set Bits
+    static_assert(std::ranges::forward_range<StaticBitVector<200, uint64_t>>);
+
+    vector3.initWithZeros();
+
+    passert(vector3.begin() == vector3.end(), "Iterate an empty vector.");
+
+    size_t expectedIndices[] = { 0, 63, 64, 130, 131, 199 };
+
+    for (size_t index : expectedIndices)
+    {
+        vector3.setBit(index);
+    }
+
+    size_t position = 0;
+
+    for (size_t index : vector3)
+    {
+        passert(position < 6 && index == expectedIndices[position], "Iterate set bits: Position %lu.", position);
+
+        position += 1;
+    }
+
+    passert(position == 6, "Iterate all set bits.");
+
+    position = 0;
+
+    vector3.forEachSetBit([&](size_t index) -> void
+    {
+        passert(position < 6 && index == expectedIndices[position], "For each set bit: Position %lu.", position);
+
+        position += 1;
+    });
+
+    passert(position == 6, "For each set bit.");
+
+    passert(std::ranges::distance(vector3) == 6, "Compatibility: Ranges.");
+
+    pinfo("Iterate Set Bits: Test Passed.");
+
+    // Test Bitwise Algebra
+    // 125 blocks cover both the vectorized loop and the scalar tail
+    StaticBitVector<1000, uint8_t> lhs, rhs, result;
+
+    lhs.initWithZeros();
+
+    rhs.initWithZeros();
+
+    for (size_t index = 0; index < 1000; index += 1)
+    {
+        if (index % 3 == 0)
+        {
+            lhs.setBit(index);
+        }
+
+        if (index % 5 == 0)
+        {
+            rhs.setBit(index);
+        }
+    }
+
+    result = lhs;
+
+    result &= rhs;
+
+    for (size_t index = 0; index < 1000; index += 1)
+    {
+        passert(result.containsBit(index) == (index % 15 == 0), "AND: Index %lu.", index);
+    }
+
+    result = lhs;
+
+    result |= rhs;
+
+    for (size_t index = 0; index < 1000; index += 1)
+    {
+        passert(result.containsBit(index) == (index % 3 == 0 || index % 5 == 0), "OR: Index %lu.", index);
+    }
+
+    result = lhs;
+
+    result ^= rhs;
+
+    for (size_t index = 0; index < 1000; index += 1)
+    {
+        passert(result.containsBit(index) == ((index % 3 == 0) != (index % 5 == 0)), "XOR: Index %lu.", index);
+    }
+
+    result = lhs;
+
+    result.andNot(rhs);
+
+    for (size_t index = 0; index < 1000; index += 1)
+    {
+        passert(result.containsBit(index) == (index % 3 == 0 && index % 5 != 0), "ANDNOT: Index %lu.", index);
+    }
+
+    passert(lhs.intersects(rhs), "Intersect: Multiples of 15 are in common.");
+
+    passert(!result.intersects(rhs), "Intersect: Nothing in common after ANDNOT.");
+
+    passert(!lhs.isSubsetOf(rhs), "Subset: Multiples of 3 are not multiples of 5.");
+
+    passert(result.isSubsetOf(lhs), "Subset: ANDNOT produces a subset.");
+
+    // The only common bit is in the scalar tail
+    result.initWithZeros();
+
+    result.setBit(999);
+
+    passert(result.intersects(rhs) == rhs.containsBit(999), "Intersect: The last bit.");
+
+    passert(!result.isSubsetOf(rhs), "Subset: The last bit.");
+
+    result |= rhs;
+
+    passert(rhs.isSubsetOf(result) && result.isSubsetOf(result), "Subset: Union and itself.");
+
+    result.initWithZeros();
+
+    passert(!result.intersects(lhs) && result.isSubsetOf(lhs), "An empty vector.");
+
+    // 16 blocks fit entirely in vector registers
+    StaticBitVector<1024, uint64_t> lhs64, rhs64;
+
+    lhs64.initWithOnes();
+
+    rhs64.initWithZeros();
+
+    rhs64.setBit(517);
+
+    passert(lhs64.intersects(rhs64) && rhs64.isSubsetOf(lhs64), "Intersect/Subset: A single bit.");
+
+    lhs64.andNot(rhs64);
+
+    passert(lhs64.count() == 1023 && !lhs64.containsBit(517), "ANDNOT: A single bit.");
+
+    passert(!lhs64.intersects(rhs64) && !rhs64.isSubsetOf(lhs64), "Intersect/Subset: A single bit after ANDNOT.");
+
+    lhs64 ^= rhs64;
+
+    passert(lhs64.count() == 1024, "XOR: A single bit.");
+
+    pinfo("Bitwise Algebra: Test Passed.");
+
+    // Test Wide Storage Units
+    testWideStorageUnit<UInt128>();
+
+    testWideStorageUnit<WideUnsignedInteger<2>>();
+
+    testWideStorageUnit<UInt256>();
+
+    pinfo("Wide Storage Units: Test Passed.");
+
+    // Test Constant Initialization
+    static constexpr auto kReserved = StaticBitVector<100, uint8_t>::createWithRanges(ClosedRange<size_t>(0, 9), ClosedRange<size_t>(96, 99));
+
+    static_assert(kReserved.containsBit(9) && !kReserved.containsBit(10) && kReserved.getBit(99) == 1, "Constexpr Ranges");
+
+    static_assert(StaticBitVector<12, uint8_t>::createWithBits(11).containsBit(11) && !StaticBitVector<12, uint8_t>::createWithOnes().containsBit(12), "Constexpr Bits/Ones");
+
+    testConstantInitialization<uint8_t>();
+
+    testConstantInitialization<uint64_t>();
+
+    testConstantInitialization<UInt256>();
+
+    pinfo("Constant Initialization: Test Passed.");
+
     pinfof("==== TEST STATIC BIT VECTOR FINISHED ====\n");
 }
@@ -10,10 +10,19 @@
 
 // Umbrella Header
 
+#include "AtomicStaticBitVectorTest.hpp"
 #include "BitMasksTest.hpp"
+#include "BitMatrixTest.hpp"
 #include "BitOptionsTest.hpp"
+#include "CompressedBitVectorTest.hpp"
+#include "CPUDispatchTest.hpp"
+#include "DynamicBitVectorTest.hpp"
+#include "HierarchicalStaticBitVectorTest.hpp"
 #include "LinkedListTest.hpp"
+#include "PairingHeapTest.hpp"
+#include "RedBlackTreeTest.hpp"
 #include "SignificantBitTest.hpp"
+#include "SkipListTest.hpp"
 #include "StaticBitVectorTest.hpp"
 
 #endif /* TinkerLibraryTests_hpp */
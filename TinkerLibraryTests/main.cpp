@@ -9,18 +9,36 @@
 #include <TestSuite.hpp>
 #include <Debug.hpp>
 
+static AtomicStaticBitVectorTest atomicStaticBitVectorTest;
 static BitMasksTest bitMasksTest;
+static BitMatrixTest bitMatrixTest;
 static BitOptionsTest bitOptionsTest;
+static CompressedBitVectorTest compressedBitVectorTest;
+static CPUDispatchTest cpuDispatchTest;
+static DynamicBitVectorTest dynamicBitVectorTest;
+static HierarchicalStaticBitVectorTest hierarchicalStaticBitVectorTest;
 static LinkedListTest linkedListTest;
+static PairingHeapTest pairingHeapTest;
+static RedBlackTreeTest redBlackTreeTest;
 static SignificantBitTest significantBitTest;
+static SkipListTest skipListTest;
 static StaticBitVectorTest staticBitVectorTest;
 
 static TestSuite* tests[] =
 {
+    &atomicStaticBitVectorTest,
     &bitMasksTest,
+    &bitMatrixTest,
     &bitOptionsTest,
+    &compressedBitVectorTest,
+    &cpuDispatchTest,
+    &dynamicBitVectorTest,
+    &hierarchicalStaticBitVectorTest,
     &linkedListTest,
+    &pairingHeapTest,
+    &redBlackTreeTest,
     &significantBitTest,
+    &skipListTest,
     &staticBitVectorTest
 };
 